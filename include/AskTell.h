@@ -0,0 +1,124 @@
+#ifndef ASK_TELL_H
+#define ASK_TELL_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace adef {
+
+class Repository;
+class Population;
+class Individual;
+
+/**
+@brief AskTell evolves a Repository by the caller, who evaluates
+the individuals.
+
+Instead of Evolution::evolve(), which owns the whole loop, the caller
+repeats
+- ask(): it returns the batch of individuals to evaluate. The first batch
+  is the initial population, and the others are the offspring of each
+  generation.
+- tell(): it gives the fitness of the batch, then the environmental
+  selection, the statistics and the control mechanisms advance.
+.
+until is_terminated(). The termination is the same as Evolution:
+the maximum of generation or the criteria of Statistics, e.g., success.
+The batch is cut to the budget of FEs, and the individuals out of it get
+the maximum fitness as Evaluator does.
+
+The batch is a view of the decision variables of the individuals, which
+is valid until the next tell(). Nothing is copied.
+
+The Evaluator and the Surrogate of the Repository are not used, and
+each told fitness is counted as a fitness evaluation.
+IslandEvolution is not supported.
+*/
+class AskTell
+{
+public:
+
+/// The read-only view of the individuals to evaluate.
+    struct Batch {
+
+        const double* const* variables;  ///< The decision variables of each.
+        std::size_t size;                ///< The number of individuals.
+        std::size_t dimension;           ///< The number of decision variables.
+    };
+
+/**
+@brief Evolve the Repository.
+@param repos The Repository prepared by Experiment::prepare_run().
+*/
+    explicit AskTell(std::shared_ptr<Repository> repos);
+/**
+@brief Create the AskTell of the run of the experiment in
+the configuration file.
+@param config_file The path of the configuration file.
+@param experiment The index of the experiment, see System::make_experiment().
+@param run The index of the run, which decides the random stream.
+*/
+    static std::shared_ptr<AskTell> create(const std::string& config_file,
+                                           std::size_t experiment = 0,
+                                           unsigned int run = 0);
+
+/**
+@brief Return the individuals to evaluate.
+
+It returns the same batch until tell(), and the empty batch after
+the termination.
+*/
+    Batch ask();
+/**
+@brief Give the fitness of the batch and evolve the generation.
+
+The fitness is also the first objective value.
+@param fitness The fitness of each individual of the batch.
+@exception std::logic_error It is called without ask().
+*/
+    void tell(const double* fitness);
+
+/**
+@brief Return @c true if the evolution terminates.
+*/
+    bool is_terminated() const { return terminated_; }
+/**
+@brief Return the generation of the next batch. The initial population
+is the generation 0.
+*/
+    unsigned int generation() const { return generation_; }
+/**
+@brief Return the individual of the minimum fitness in the current
+population.
+@exception std::logic_error No batch has been told.
+*/
+    const Individual& best() const;
+/**
+@brief Return the Repository, whose population is the current one.
+*/
+    std::shared_ptr<const Repository> repository() const { return repos_; }
+
+private:
+
+/**
+@brief Return the Population of the batch.
+*/
+    const std::shared_ptr<Population>& batch_population();
+
+/// The Repository to evolve.
+    std::shared_ptr<Repository> repos_;
+/// The generation of the next batch.
+    unsigned int generation_;
+/// Whether the batch is asked and not told yet.
+    bool asked_;
+/// Whether the evolution terminates.
+    bool terminated_;
+/// The decision variables of the batch.
+    std::vector<const double*> variables_;
+};
+
+}
+
+#endif // ASK_TELL_H
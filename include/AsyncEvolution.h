@@ -0,0 +1,119 @@
+#ifndef ASYNC_EVOLUTION_H
+#define ASYNC_EVOLUTION_H
+
+#include <memory>
+#include "Evolution.h"
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+class Repository;
+
+/**
+@brief AsyncEvolution evolves DE in the steady state, so the evaluations
+do not wait for each other.
+
+The initial population is evaluated by Evaluator as Evolution. Then
+"number_of_workers" threads evaluate the trial vectors by the Problem,
+each one at a time. When a worker finishes:
+- the control mechanisms of @em F and @em CR select by the result,
+- the trial vector replaces its target if it is not worse,
+- the trial vector of the next slot which is not being evaluated is
+  generated, i.e., the control mechanisms update and generate, and
+  DEMutation, DECrossover and Repair build it, and it is sent to
+  the same worker.
+.
+The workers and the evolution communicate by lock-free
+single-producer/single-consumer queues, and all states except the
+evaluated trial vectors are accessed only by the thread of evolve().
+
+Every population-size evaluations are a generation: the statistics are
+taken, the termination is checked, and the generation of Parameters and
+Repository increases. The evolution stops after "max_generation"
+generations, i.e., the same number of fitness evaluations as Evolution,
+or when the criteria of Statistics are satisfied. No trial vector is
+sent beyond the budget of FEs of Statistics.
+
+Since the order of results depends on the evaluation times, the result
+is not reproducible. Evaluator is not used after the initialization.
+At the end of each generation, the statistics item "parents" is
+the population, and "offspring" is the fitness of the latest evaluated
+trial vector of each slot (the fitness of its target before the first
+one), because the trial vectors in evaluation are not read.
+The Problem is evaluated by the workers at the same time, so a Problem
+which is not shareable (see Prototype::is_shareable()) is cloned for
+each worker, and a Problem which is not deterministic is evaluated by
+one worker at a time.
+It requires DEMutation and DECrossover.
+
+@par The configuration
+AsyncEvolution has extra configurations:
+- member
+    - name: "max_generation"
+    - value: <tt>unsigned int</tt>
+- member
+    - name: "number_of_workers"
+    - value: <tt>unsigned int</tt>
+.
+It has default configurations:
+- number_of_workers: the number of hardware threads.
+.
+See setup() for the details.
+*/
+class AsyncEvolution : public Evolution
+{
+public:
+
+/**
+@brief Clone the current class.
+@sa clone_impl()
+*/
+    std::shared_ptr<AsyncEvolution> clone() const
+    {
+        return std::dynamic_pointer_cast<AsyncEvolution>(clone_impl());
+    }
+/**
+@brief Set up the internal states.
+
+If AsyncEvolution has the following configuration:
+- max_generation: 1000
+- number_of_workers: 8
+.
+its configuration should be
+- JSON configuration
+@code
+"Evolution" : {
+    "classname" : "AsyncEvolution",
+    "max_generation" : 1000,
+    "number_of_workers" : 8
+}
+@endcode
+.
+*/
+    void setup(const Configuration& config,
+               const PrototypeManager& pm) override;
+/**
+@brief Evolve the algorithm in the steady state.
+@param repos The Repository to evolve.
+*/
+    void evolve(std::shared_ptr<Repository> repos) const override;
+
+private:
+
+/**
+@brief The number of threads evaluating the trial vectors.
+*/
+    unsigned int number_of_workers_;
+
+private:
+
+    std::shared_ptr<Prototype> clone_impl() const override
+    {
+        return std::make_shared<AsyncEvolution>(*this);
+    }
+};
+
+}
+
+#endif
@@ -49,10 +49,11 @@ BoundedRepair's configuration should be
                const PrototypeManager& pm) override;
 
     void init(std::shared_ptr<Repository> repos) override;
+    bool is_shareable() const override { return true; }
 
-    void repair_function(std::shared_ptr<Individual> individual,
+    void repair_function(Individual& individual,
                          std::size_t dim,
-                         std::shared_ptr<const Problem> problem) const override;
+                         const Problem& problem) const override;
 
 private:
 
@@ -39,8 +39,9 @@ public:
 /**
 @brief Construct a Configuration by another one.
 
-Note that the configuration data is deep copied,
-but the builder is shadow copied.
+Note that both the configuration data and the builder are shadow copied.
+The configuration data is an immutable view into the loaded document,
+so the copies never change each other.
 */
     Configuration(const Configuration& rhs);
     ~Configuration() = default;
@@ -179,6 +180,42 @@ but the builder is shadow copied.
     double get_double_value(unsigned int index) const;
 ///@}
 
+/**
+@name sweep operators
+*/
+///@{
+/**
+@brief Return the number of configurations which the sweeps in
+the configuration data expand to.
+
+It is 1 if there is no sweep. See JsonConfigurationBuilder for
+the syntax of sweeps.
+*/
+    unsigned int get_sweep_size() const;
+/**
+@brief Return the configuration whose sweeps are replaced by the values
+of the combination.
+
+Only the combination of @a index is materialized, so the sweep of any
+size costs the same. It returns the same configuration data if there is
+no sweep.
+@param index The index of the combination in [0, get_sweep_size()).
+
+@exception std::out_of_range @a index is not less than get_sweep_size().
+*/
+    Configuration get_sweep_config(unsigned int index) const;
+/**
+@brief Return the label of the values of the combination, which
+distinguishes the combinations, e.g., <tt>F0.5_CR0.9</tt>.
+
+It is empty if there is no sweep of the scalar values.
+@param index The index of the combination in [0, get_sweep_size()).
+
+@exception std::out_of_range @a index is not less than get_sweep_size().
+*/
+    std::string get_sweep_label(unsigned int index) const;
+///@}
+
 /**
 @name value operators
 */
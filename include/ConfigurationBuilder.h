@@ -144,6 +144,37 @@ public:
         std::shared_ptr<const ConfigurationData> config_data) const = 0;
 ///@}
 
+/**
+@name sweep operators
+*/
+///@{
+/**
+@brief Return the number of configuration data which the sweeps in
+the configuration data expand to.
+@param config_data The configuration data to access.
+*/
+    virtual unsigned int get_sweep_size(
+        std::shared_ptr<const ConfigurationData> config_data) const = 0;
+/**
+@brief Return the configuration data whose sweeps are replaced by
+the values of the combination.
+@param index The index of the combination.
+@param config_data The configuration data to access.
+*/
+    virtual std::shared_ptr<ConfigurationData> get_sweep_config_data(
+        unsigned int index,
+        std::shared_ptr<const ConfigurationData> config_data) const = 0;
+/**
+@brief Return the label of the values of the combination, which is
+empty if no sweep is labeled.
+@param index The index of the combination.
+@param config_data The configuration data to access.
+*/
+    virtual std::string get_sweep_label(
+        unsigned int index,
+        std::shared_ptr<const ConfigurationData> config_data) const = 0;
+///@}
+
 /**
 @name value operators
 */
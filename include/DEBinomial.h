@@ -49,14 +49,12 @@ DEBinomial's configuration should be
 
     void init(std::shared_ptr<Repository> repos) override;
 
-    std::shared_ptr<Individual> crossover(
-                                std::shared_ptr<const Individual> mutant_vector,
-                                std::shared_ptr<const Individual> target_vector,
-                                double crossover_rate) const override;
-
-protected:
-
-    std::shared_ptr<Random> random_;
+    using DEVariantZ::crossover;
+    void crossover(const IndividualContext& context,
+                   const Individual& mutant_vector,
+                   const Individual& target_vector,
+                   double crossover_rate,
+                   Individual& trial_vector) const override;
 
 private:
 
@@ -3,12 +3,14 @@
 
 #include <memory>
 #include "Crossover.h"
+#include "IndividualContext.h"
 
 namespace adef {
 
 class Configuration;
 class PrototypeManager;
 class Repository;
+class Population;
 class Individual;
 class DEVariantZ;
 class BaseControlMechanism;
@@ -70,15 +72,30 @@ DECrossover's configuration should be
     void init(std::shared_ptr<Repository> repos) override;
 
     void crossover(std::shared_ptr<Repository> repos) const override;
+/**
+@brief Replace the mutant vector of the target individual by the trial
+vector in place.
+
+It is the step of crossover() for one individual, which is also used
+by AsyncEvolution.
+@param context The context of the target individual.
+@param target The population of target vectors.
+@param crossover_rate The crossover probability.
+@param trial_vector The mutant vector to become the trial vector.
+*/
+    void crossover(const IndividualContext& context, const Population& target,
+                   double crossover_rate, Individual& trial_vector) const;
 
 /**
 @brief Exchange and produce a child in DE.
+@param context The context of the target individual.
 @param mutant_vector The mutated vector.
 @param target_vector The target vector.
 @param crossover_rate The crossover probability.
 @return The trial vector.
 */
     std::shared_ptr<Individual> crossover(
+                                const IndividualContext& context,
                                 std::shared_ptr<const Individual> mutant_vector,
                                 std::shared_ptr<const Individual> target_vector,
                                 double crossover_rate) const;
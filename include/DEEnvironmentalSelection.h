@@ -50,6 +50,7 @@ DEEnvironmentalSelection's configuration should be
                const PrototypeManager& pm) override;
 
     void init(std::shared_ptr<Repository> repos) override;
+    bool is_shareable() const override { return true; }
 
     void select(std::shared_ptr<Repository> repos) const override;
 
@@ -57,10 +58,11 @@ private:
 
 /**
 @brief Select which individual can survive.
+@return @a lhs or @a rhs itself, so the survivor is copied only if
+        it is not the parent.
 */
-    std::shared_ptr<Individual> select(
-                                std::shared_ptr<const Individual> lhs,
-                                std::shared_ptr<const Individual> rhs) const;
+    const Individual& select(const Individual& lhs,
+                             const Individual& rhs) const;
 
 private:
 
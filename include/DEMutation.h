@@ -3,12 +3,14 @@
 
 #include <memory>
 #include "Mutation.h"
+#include "IndividualContext.h"
 
 namespace adef {
 
 class Configuration;
 class PrototypeManager;
 class Repository;
+class Population;
 class Individual;
 class Random;
 class DEVariantX;
@@ -78,6 +80,18 @@ DEMutation's configuration should be
     void init(std::shared_ptr<Repository> repos) override;
 
     void mutate(std::shared_ptr<Repository> repos) const override;
+/**
+@brief Build the mutant vector of the target individual.
+
+It is the step of mutate() for one individual, which is also used by
+AsyncEvolution.
+@param context The context of the target individual.
+@param parent The population of parents.
+@param F The scaling factor.
+@param mutant_vector The mutant vector to build.
+*/
+    void mutate(const IndividualContext& context, const Population& parent,
+                double F, Individual& mutant_vector) const;
 
 /**
 @brief Mutate into a new individual in DE.
@@ -99,17 +113,15 @@ private:
 @param number_of_result how many numbers are generated.
 @param min_range The minimum of generated number.
 @param max_range The maximum of generated number.
+@param random The random generator of the calling thread.
 @return The sequential numbers.
 */
     std::vector<std::size_t> exclusive_random_number_generator(
                                        std::vector<std::size_t>& used_numbers,
                                        unsigned int number_of_result,
                                        unsigned int min_range,
-                                       unsigned int max_range) const;
-
-private:
-
-    std::shared_ptr<Random> random_;
+                                       unsigned int max_range,
+                                       std::shared_ptr<Random> random) const;
 
 /**
 @brief The DE variant @e x.
@@ -50,10 +50,11 @@ DERand's configuration should be
 
     unsigned int number_of_indexes() const override;
 
-    std::shared_ptr<Individual> base_vector(
-                std::size_t target_index,
-                const std::vector<std::size_t>& random_indexes,
-                std::shared_ptr<const Population> population) const override;
+    using DEVariantX::base_vector;
+    void base_vector(std::size_t target_index,
+                     const std::vector<std::size_t>& random_indexes,
+                     const Population& population,
+                     Individual& result) const override;
 
 private:
 
@@ -45,6 +45,7 @@ DEReproduction's configuration should be
                const PrototypeManager& pm) override;
 
     void init(std::shared_ptr<Repository> repos) override;
+    bool is_shareable() const override { return true; }
 
     void reproduce(std::shared_ptr<Repository> repos) const override;
 
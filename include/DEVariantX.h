@@ -5,6 +5,8 @@
 #include <cstddef>
 #include <vector>
 #include "Prototype.h"
+#include "Individual.h"
+#include "Population.h"
 
 namespace adef {
 
@@ -53,16 +55,31 @@ If @em Class is derived from DEVariantX, its configuration should be
     virtual unsigned int number_of_indexes() const = 0;
 
 /**
-@brief Return the base vector.
+@brief Store the base vector into the result.
 @param target_index The index of the target vector.
 @param random_indexes The sequential indexes.
 @param population The population to get individuals.
-@return The base vector.
+@param result The individual to store the base vector, which is not
+       in @a population.
+*/
+    virtual void base_vector(std::size_t target_index,
+                             const std::vector<std::size_t>& random_indexes,
+                             const Population& population,
+                             Individual& result) const = 0;
+/**
+@brief Return the base vector.
+@sa base_vector(std::size_t, const std::vector<std::size_t>&,
+                const Population&, Individual&)
 */
-    virtual std::shared_ptr<Individual> base_vector(
+    std::shared_ptr<Individual> base_vector(
                         std::size_t target_index,
                         const std::vector<std::size_t>& random_indexes,
-                        std::shared_ptr<const Population> population) const = 0;
+                        std::shared_ptr<const Population> population) const
+    {
+        auto result = population->at(target_index)->empty_clone();
+        base_vector(target_index, random_indexes, *population, *result);
+        return result;
+    }
 
 private:
 
@@ -70,6 +70,20 @@ its configuration should be
     std::vector<std::shared_ptr<Individual>> difference_vector(
                             const std::vector<std::size_t>& random_indexes,
                             std::shared_ptr<const Population> population) const;
+/**
+@brief Add the scaled difference vector to the mutant vector.
+
+It is the same as adding @a F times each of difference_vector() to
+@a mutant_vector, but it does not create the difference vectors.
+@param random_indexes The sequential indexes.
+@param population The population to get individuals.
+@param F The scaling factor.
+@param mutant_vector The mutant vector to add to.
+*/
+    void add_difference_vector(const std::vector<std::size_t>& random_indexes,
+                               const Population& population,
+                               double F,
+                               Individual& mutant_vector) const;
 
 private:
 
@@ -3,6 +3,8 @@
 
 #include <memory>
 #include "Prototype.h"
+#include "IndividualContext.h"
+#include "Individual.h"
 
 namespace adef {
 
@@ -51,16 +53,39 @@ If @em Class is derived from DEVariantZ, its configuration should be
 */
     virtual void init(std::shared_ptr<Repository> repos) = 0;
 /**
-@brief Produce a child from parents.
+@brief Produce a child from parents into the trial vector.
+
+The trial vector has the objectives and the fitness of the target
+vector, like a copy of it whose genes are crossed.
+@param context The context of the target individual.
 @param mutant_vector The mutated vector.
 @param target_vector The target vector.
 @param crossover_rate The crossover probability.
+@param trial_vector The trial vector to store the child. It may be
+       @a mutant_vector or @a target_vector itself.
+*/
+    virtual void crossover(const IndividualContext& context,
+                           const Individual& mutant_vector,
+                           const Individual& target_vector,
+                           double crossover_rate,
+                           Individual& trial_vector) const = 0;
+/**
+@brief Produce a child from parents.
 @return The trial vector.
+@sa crossover(const IndividualContext&, const Individual&,
+              const Individual&, double, Individual&)
 */
-    virtual std::shared_ptr<Individual> crossover(
+    std::shared_ptr<Individual> crossover(
+                                const IndividualContext& context,
                                 std::shared_ptr<const Individual> mutant_vector,
                                 std::shared_ptr<const Individual> target_vector,
-                                double crossover_rate) const = 0;
+                                double crossover_rate) const
+    {
+        auto trial = target_vector->clone();
+        crossover(context, *mutant_vector, *target_vector,
+                  crossover_rate, *trial);
+        return trial;
+    }
 
 private:
 
@@ -2,8 +2,11 @@
 #define EVALUATOR_H
 
 #include <memory>
+#include <vector>
+#include <cstddef>
 #include "Prototype.h"
 #include "EvolutionaryState.h"
+#include "util/evaluation_cache.h"
 
 namespace adef {
 
@@ -13,14 +16,71 @@ class Repository;
 class Problem;
 class Population;
 class Statistics;
+class Individual;
 
 /**
 @brief Evaluator evaluates a value of the individual.
 
 Call evaluate() to evaluate.
 
+If the Problem is deterministic (see Problem::is_deterministic()),
+Evaluator can reuse the results of evaluations instead of evaluating
+again:
+- the individual which is identical to its target, e.g., the trial
+  vector whose genes are all from the target vector, copies the
+  objectives and the fitness of the target.
+- the individual which is identical to one of the latest evaluated
+  individuals copies the results from the evaluation cache, which keeps
+  a bounded number of entries and evicts the least recently used one.
+.
+The reused evaluations are counted by
+Statistics::increase_number_of_cache_hits() instead of the fitness
+evaluations (FEs).
+
+The individuals which are not reused are evaluated together by
+Problem::evaluate_batch(), so the Problem can evaluate them in parallel.
+The individual identical to another one of the same population copies
+its results after the batch, which is the same as the cache hit.
+
+Evaluator never evaluates more individuals than
+Statistics::remaining_fitness_evaluations(). The individuals out of
+the budget are not evaluated, and their fitness is the maximum of
+@c double, so they lose in the selection.
+
+If the Problem is separable (see Problem::number_of_separable_sums()),
+Evaluator can evaluate the individual which differs from its target in
+at most half of the decision variables from the terms of the target by
+Problem::evaluate_partially(). The changed decision variables are found
+by comparing the individual with its target, so they are correct after
+any crossover and repair. With "delta_evaluation_check", every partial
+evaluation is also evaluated from scratch, and std::runtime_error is
+thrown if their sums differ by more than the rounding errors. It costs
+a full evaluation each and is meant for checking a Problem.
+
 @par The configuration
-Evaluator has no extra configurations.@n
+Evaluator has extra configurations:
+- member (optional)
+    - name: "cache_size"
+    - value: @c unsigned @c int
+.
+- member (optional)
+    - name: "skip_unchanged"
+    - value: @c bool
+.
+- member (optional)
+    - name: "delta_evaluation"
+    - value: @c bool
+.
+- member (optional)
+    - name: "delta_evaluation_check"
+    - value: @c bool
+.
+It has default configurations:
+- cache_size: 0, i.e., no evaluation cache.
+- skip_unchanged: false
+- delta_evaluation: false
+- delta_evaluation_check: false
+.
 See setup() for the details.
 */
 class Evaluator : public Prototype, public EvolutionaryState
@@ -45,7 +105,10 @@ Evaluator's configuration should be
 - JSON configuration
 @code
 "Evaluator" : {
-    "classname" : "Evaluator"
+    "classname" : "Evaluator",
+    "cache_size" : 1000,
+    "skip_unchanged" : true,
+    "delta_evaluation" : true
 }
 @endcode
 .
@@ -54,16 +117,83 @@ Evaluator's configuration should be
                        const PrototypeManager& pm) override;
 
     virtual void init(std::shared_ptr<Repository> repos) override;
+/**
+@brief Return whether the Evaluator is shared by the runs.
+
+The evaluation cache belongs to one run, so Evaluator is shared only if
+it has no cache.
+*/
+    virtual bool is_shareable() const override
+    {
+        return cache_.capacity() == 0;
+    }
 
 /**
-@brief Evaluate an individual with specific problem.
+@brief Evaluate the individuals with specific problem.
+@param pop The individuals to evaluate.
+@param targets The targets of the individuals at the same index, which
+       are evaluated already. It can be @c nullptr.
+@param problem The problem to evaluate.
+@param statistics The statistics to count the evaluations.
 */
     virtual void evaluate(std::shared_ptr<Population> pop,
+                          std::shared_ptr<const Population> targets,
                           std::shared_ptr<const Problem> problem,
                           std::shared_ptr<Statistics> statistics) const;
+/**
+@brief Evaluate the individuals which have no targets.
+*/
+    void evaluate(std::shared_ptr<Population> pop,
+                  std::shared_ptr<const Problem> problem,
+                  std::shared_ptr<Statistics> statistics) const
+    {
+        evaluate(pop, nullptr, problem, statistics);
+    }
 
 private:
 
+/**
+@brief Copy the objectives and the fitness of the target if the
+individual is identical to it.
+@return True if they are copied.
+*/
+    bool reuse_target(Individual& individual, const Individual& target) const;
+/**
+@brief Copy the objectives and the fitness from the cache.
+@return True if the individual is found in the cache.
+*/
+    bool reuse_cache(Individual& individual) const;
+/**
+@brief Evaluate the individual separably, from the terms of its target
+if it changes a few decision variables.
+@param individual The individual to evaluate.
+@param target The target of the individual, or @c nullptr.
+@param problem The separable problem.
+@param changed_indexes The buffer of the changed dimensions.
+*/
+    void evaluate_delta(Individual& individual, const Individual* target,
+                        const Problem& problem,
+                        std::vector<std::size_t>& changed_indexes) const;
+/**
+@brief Compare the sums of the partially evaluated individual with
+those evaluated from scratch.
+@exception std::runtime_error They differ by more than the rounding
+errors.
+*/
+    void check_delta(const Individual& individual,
+                     const Problem& problem) const;
+
+private:
+
+/// Whether to copy the results of the unchanged individuals.
+    bool skip_unchanged_ = false;
+/// Whether to evaluate the separable problem from the terms of targets.
+    bool delta_evaluation_ = false;
+/// Whether to compare the evaluations from the terms with those from scratch.
+    bool delta_evaluation_check_ = false;
+/// The results of the latest evaluations.
+    mutable EvaluationCache cache_;
+
     virtual std::shared_ptr<Prototype> clone_impl() const override
     {
         return std::make_shared<Evaluator>(*this);
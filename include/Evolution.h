@@ -60,6 +60,7 @@ its configuration should be
                        const PrototypeManager& pm) override;
 
     virtual void init(std::shared_ptr<Repository> repos) override;
+    virtual bool is_shareable() const override { return true; }
 
 /**
 @brief Evolve the algorithm.
@@ -67,14 +68,66 @@ its configuration should be
 */
     virtual void evolve(std::shared_ptr<Repository> repos) const;
 
-protected:
-
+/**
+@brief Return the maximum of the number of generation.
+*/
+    unsigned int max_generation() const { return max_generation_; }
 /**
 @brief Check the termination of evolution.
+
+The termination criteria except "max_generation" are configured in
+Statistics, see Statistics::termination_reason().
 @param repos The Repository to check the termination.
 @return true if it reached the termination.
 */
     virtual bool is_evolve_terminated(std::shared_ptr<const Repository> repos) const;
+/**
+@brief Record the reason why the evolution of the Repository stops
+in its Statistics.
+
+The reason is "max_generation" if none of the criteria of Statistics
+is satisfied.
+@param repos The Repository which stops.
+*/
+    void record_stop_reason(std::shared_ptr<Repository> repos) const;
+
+/**
+@brief Initialize the population of the Repository without evaluation.
+
+The stages of evolution without evaluation are used by AskTell, which
+lets the caller evaluate the individuals.
+@param repos The Repository to initialize.
+*/
+    void initialize_population(std::shared_ptr<Repository> repos) const;
+/**
+@brief Reproduce the offspring of the generation without evaluation.
+@param repos The Repository to reproduce.
+@param gen The current generation.
+*/
+    void reproduce_generation(std::shared_ptr<Repository> repos,
+                              unsigned int gen) const;
+/**
+@brief Select the population from the evaluated offspring and
+take the statistics of the generation.
+@param repos The Repository to select.
+*/
+    void select_generation(std::shared_ptr<Repository> repos) const;
+
+protected:
+
+/**
+@brief Initialize and evaluate the population of the Repository.
+@param repos The Repository to initialize.
+*/
+    virtual void initialize_evolution(std::shared_ptr<Repository> repos) const;
+
+/**
+@brief Evolve the Repository by one generation.
+@param repos The Repository to evolve.
+@param gen The current generation.
+*/
+    virtual void evolve_generation(std::shared_ptr<Repository> repos,
+                                   unsigned int gen) const;
 
 protected:
 
@@ -27,8 +27,31 @@ public:
 @param repos The Repository to get initialization informations.
 */
     virtual void init(std::shared_ptr<Repository> repos) = 0;
+/**
+@brief Return whether the state has no mutable states after setup().
+
+Such a state, e.g., the operator which only keeps its configuration,
+is shared by the copies of Repository for each run instead of being
+cloned, so it must not change in init() and may be used by the runs
+at the same time.
+The default is @c false.
+*/
+    virtual bool is_shareable() const { return false; }
 };
 
+/**
+@brief Return the state itself if it is shareable, otherwise its clone.
+@tparam T The type of the state.
+*/
+template<typename T>
+std::shared_ptr<T> share_or_clone(const std::shared_ptr<T>& state)
+{
+    if (!state || state->is_shareable()) { return state; }
+    else {
+        return state->clone();
+    }
+}
+
 }
 
 #endif // EVOLUTIONARY_STATE_H
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include "Prototype.h"
 
 namespace adef {
@@ -31,9 +32,21 @@ Experiment has extra configurations:
 - member
     - name: "Repository"
     - value: object configurations which represents Repository.
+- member (optional)
+    - name: "determinism_check"
+    - value: @c array of <tt>unsigned int</tt>
+.
+It has default configurations:
+- determinism_check: empty
 .
 See setup() for the details.
 
+"determinism_check" is a self-test of the deterministic mode of Repository.
+Each run is evolved again with each given number of threads, and
+run() throws std::runtime_error if the best fitness of any generation,
+the number of fitness evaluations or the final population differs
+bit by bit from the run with the configured number of threads.
+
 @sa See System and Repository for the content.
 */
 class Experiment : public Prototype
@@ -89,6 +102,17 @@ After finishing all of runs, it output the statistics of entire runs.
 */
     virtual void run();
 /**
+@brief Return the name of the experiment.
+*/
+    const std::string& name() const { return name_; }
+/**
+@brief Append the label to the algorithm name and the name of
+the experiment, which distinguishes the combinations of sweeps.
+
+It does nothing if @a label is empty.
+*/
+    void add_label(const std::string& label);
+/**
 @brief Return the random mechanism.
 */
     std::shared_ptr<const Random> random() const {
@@ -104,9 +128,37 @@ After finishing all of runs, it output the statistics of entire runs.
 @brief Return the repository
 */
     std::shared_ptr<const Repository> repository() const { return repository_; }
+/**
+@brief Prepare a run on a new clone of the repository.
+
+All evolutionary states are initialized with the random stream of
+the run, so the run can be evolved by Evolution::evolve() or by AskTell.
+@param times The index of the run.
+@param number_of_threads The number of threads, or 0 to keep
+the configured one.
+*/
+    std::shared_ptr<Repository> prepare_run(
+                        unsigned int times,
+                        unsigned int number_of_threads = 0) const;
 
 protected:
 
+/**
+@brief Evolve a run on a new clone of the repository.
+@param times The index of the run.
+@param number_of_threads The number of threads, or 0 to keep
+the configured one.
+*/
+    std::shared_ptr<Repository> evolve_run(
+                        unsigned int times,
+                        unsigned int number_of_threads) const;
+/**
+@brief Return @c true if two evolved repositories have bitwise identical
+results.
+*/
+    bool is_identical(std::shared_ptr<const Repository> lhs,
+                      std::shared_ptr<const Repository> rhs) const;
+
 /**
 @brief The name of the experiment.
 */
@@ -127,6 +179,10 @@ protected:
 @brief The repository contained by the experiment.
 */
     std::shared_ptr<Repository> repository_;
+/**
+@brief The numbers of threads to check the determinism of each run.
+*/
+    std::vector<unsigned int> determinism_check_;
 
 private:
 
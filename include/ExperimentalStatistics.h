@@ -17,6 +17,9 @@ ExperimentalStatistics collects the data of each run, including
 1. the number of the fitness evaluations (FEs)
 2. the error
 3. the best fitness
+4. the number of the evaluations reused by Evaluator (cache hits)
+5. the number of the evaluations saved by Surrogate
+6. the reason why the evolution stops, see Statistics::stop_reason()
 .
 */
 class ExperimentalStatistics : public Prototype
@@ -81,6 +84,21 @@ ExperimentalStatistics has the following configuration:
 @brief Return the value of the best fitness on each run.
 */
     const RunList<double>& best_fitness() const { return best_fitness_; }
+/**
+@brief Return the number of the evaluations reused by Evaluator on each run.
+*/
+    const RunList<double>& cache_hits() const { return cache_hits_; }
+/**
+@brief Return the number of the evaluations saved by Surrogate on each run.
+*/
+    const RunList<double>& saved_evaluations() const
+    {
+        return saved_evaluations_;
+    }
+/**
+@brief Return the reason why the evolution stops on each run.
+*/
+    const RunList<std::string>& stop_reasons() const { return stop_reasons_; }
 
 protected:
 
@@ -90,6 +108,12 @@ protected:
     RunList<double> error_;
 /// The best fitness of each run.
     RunList<double> best_fitness_;
+/// The number of the evaluations reused by Evaluator of each run.
+    RunList<double> cache_hits_;
+/// The number of the evaluations saved by Surrogate of each run.
+    RunList<double> saved_evaluations_;
+/// The reason why the evolution stops of each run.
+    RunList<std::string> stop_reasons_;
 
 private:
 
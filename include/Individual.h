@@ -79,18 +79,38 @@ Individual's initialization do the following things:
 @brief Check whether the current individual is bounded within the problem.
 @param problem The problem which is used to check.
 */
-    virtual bool is_valid(std::shared_ptr<const Problem> problem) const;
+    virtual bool is_valid(const Problem& problem) const;
 /**
 @brief Check whether the value of the dimension is bounded within the problem.
 @param dimension The value of the dimension to check.
 @param problem The problem which is used to check.
 */
-    virtual bool is_valid(std::size_t dimension,
-                          std::shared_ptr<const Problem> problem) const;
+    virtual bool is_valid(std::size_t dimension, const Problem& problem) const;
+/**
+@brief Check whether the current individual is bounded within the problem.
+@sa is_valid(const Problem&)
+*/
+    bool is_valid(std::shared_ptr<const Problem> problem) const
+    {
+        return is_valid(*problem);
+    }
+/**
+@brief Check whether the value of the dimension is bounded within the problem.
+@sa is_valid(std::size_t, const Problem&)
+*/
+    bool is_valid(std::size_t dimension,
+                  std::shared_ptr<const Problem> problem) const
+    {
+        return is_valid(dimension, *problem);
+    }
 /**
 @brief Replace the contents to other.
 */
-    void replace(std::shared_ptr<const Individual> rhs);
+    void replace(const Individual& rhs);
+/**
+@brief Replace the contents to other.
+*/
+    void replace(std::shared_ptr<const Individual> rhs) { replace(*rhs); }
 /**
 @name Value operators
 The operators of accessing values.
@@ -111,6 +131,28 @@ The operators of accessing values.
 */
     const VariableType& variables(std::size_t index = 0) const;
 /**
+@brief Return the contiguous decision variables,
+whose size is dimension_of_variable().
+
+It is used by the per-gene loops without bounds checking.
+*/
+    VariableType* variable_data() { return variables_.data(); }
+/**
+@brief Return the contiguous decision variables,
+whose size is dimension_of_variable().
+*/
+    const VariableType* variable_data() const { return variables_.data(); }
+/**
+@brief Return the contiguous objective values,
+whose size is dimension_of_objective().
+*/
+    ObjectiveType* objective_data() { return objectives_.data(); }
+/**
+@brief Return the contiguous objective values,
+whose size is dimension_of_objective().
+*/
+    const ObjectiveType* objective_data() const { return objectives_.data(); }
+/**
 @brief Return the size of objective values.
 */
     std::size_t dimension_of_objective() const { return objectives_.size(); }
@@ -132,6 +174,37 @@ The operators of accessing values.
 @brief Return fitness value.
 */
     double fitness() const { return fitness_; }
+/**
+@brief Access the terms of the sums of a separable Problem.
+
+They are valid only after Problem::evaluate_separably() or
+Problem::evaluate_partially() with the current decision variables,
+and empty if the Problem is not evaluated separably.
+@sa Problem::number_of_separable_sums()
+*/
+    std::vector<ObjectiveType>& separable_terms() { return separable_terms_; }
+/**
+@brief Access the terms of the sums of a separable Problem.
+*/
+    const std::vector<ObjectiveType>& separable_terms() const
+    {
+        return separable_terms_;
+    }
+/**
+@brief Access the sums of a separable Problem.
+
+The number_of_separable_sums() sums are followed by their magnitudes,
+i.e., the sums of the absolute values of the terms added to them.
+@sa separable_terms(), Problem::evaluate_partially()
+*/
+    std::vector<ObjectiveType>& separable_sums() { return separable_sums_; }
+/**
+@brief Access the sums of a separable Problem.
+*/
+    const std::vector<ObjectiveType>& separable_sums() const
+    {
+        return separable_sums_;
+    }
 ///@}
 
 /**
@@ -176,6 +249,15 @@ protected:
 @brief The fitness value.
 */
     double fitness_;
+/**
+@brief The terms of the sums of a separable Problem, ordered by
+the dimension.
+*/
+    std::vector<ObjectiveType> separable_terms_;
+/**
+@brief The sums of a separable Problem.
+*/
+    std::vector<ObjectiveType> separable_sums_;
 
 private:
 
@@ -0,0 +1,30 @@
+#ifndef INDIVIDUAL_CONTEXT_H
+#define INDIVIDUAL_CONTEXT_H
+
+#include <memory>
+#include <cstddef>
+
+namespace adef {
+
+class Random;
+
+/**
+@brief IndividualContext describes the individual being processed.
+
+It is passed explicitly from the evolutionary operators to
+ControlMechanism, ControlSelection and ControlUpdate, so that
+individuals of a generation can be processed independently.
+
+@sa Repository::context() and Repository::for_each_individual().
+*/
+struct IndividualContext
+{
+/// The index of the target individual in the population.
+    std::size_t target_index;
+/// The random generator owned by the thread which processes the individual.
+    std::shared_ptr<Random> random;
+};
+
+}
+
+#endif // INDIVIDUAL_CONTEXT_H
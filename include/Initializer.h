@@ -63,9 +63,17 @@ Initializer's configuration should be
 /**
 @brief Evaluate a value by this initialization function.
 */
-    virtual void initialization_function(
-                                 std::shared_ptr<const Problem> problem,
-                                 std::shared_ptr<Individual> individual) const;
+    virtual void initialization_function(const Problem& problem,
+                                         Individual& individual) const;
+/**
+@brief Evaluate a value by this initialization function.
+@sa initialization_function(const Problem&, Individual&)
+*/
+    void initialization_function(std::shared_ptr<const Problem> problem,
+                                 std::shared_ptr<Individual> individual) const
+    {
+        initialization_function(*problem, *individual);
+    }
 
 protected:
 
@@ -0,0 +1,206 @@
+#ifndef ISLAND_EVOLUTION_H
+#define ISLAND_EVOLUTION_H
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <functional>
+#include <cstddef>
+#include "Evolution.h"
+#include "util/spsc_queue.h"
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+class Repository;
+class Individual;
+
+/**
+@brief IslandEvolution evolves several sub-populations in parallel and
+exchanges individuals among them.
+
+Each island is a full clone of the Repository, including its own
+control mechanisms, statistics and random generator, and evolves on its own
+thread. Every "migration_interval" generations an island sends copies of
+its best "number_of_migrants" individuals to its neighbors and replaces its
+worst individuals by the better immigrants which have arrived.
+
+Migrants travel through lock-free single-producer/single-consumer queues,
+one for each directed edge of the topology, so islands never wait for
+each other. Migrants are dropped if the queue of the receiver is full.
+Since the arrival of migrants depends on the scheduling of threads,
+the result is not reproducible from run to run.
+If the Repository is deterministic (see Repository::is_deterministic()),
+the islands instead stop at each migration and exchange migrants
+in the order of islands, which makes the result reproducible.
+
+The evolution terminates when all islands reach "max_generation" or
+any of them satisfies the termination criteria of its Statistics, e.g.,
+succeeds. The budget of FEs is divided equally among the islands, so
+all islands together never exceed it, while the time limit applies to
+each island. An island which stagnates only stops itself and its
+migrations, and the evolution stops by "stagnation" if all islands
+stagnate. After that, the statistics of all islands are merged
+into the statistics of the Repository, and the population of
+the island which found the best fitness is copied into the population of
+the Repository.
+
+Topologies:
+- "ring": island @em i sends migrants to island <em>(i+1) % M</em>.
+- "torus": islands are arranged in rows of "number_of_columns" islands,
+  and each island sends migrants to its right and lower neighbors
+  with wrapping around.
+.
+
+@par The configuration
+IslandEvolution has extra configurations:
+- member
+    - name: "max_generation"
+    - value: <tt>unsigned int</tt>
+- member
+    - name: "number_of_islands"
+    - value: <tt>unsigned int</tt>
+- member
+    - name: "migration_interval"
+    - value: <tt>unsigned int</tt>
+- member
+    - name: "number_of_migrants"
+    - value: <tt>unsigned int</tt>
+- member (optional)
+    - name: "topology"
+    - value: @c string, "ring" or "torus"
+- member (optional)
+    - name: "number_of_columns"
+    - value: <tt>unsigned int</tt>
+.
+It has default configurations:
+- topology: "ring"
+- number_of_columns: the largest divisor of "number_of_islands"
+  which is not greater than its square root.
+.
+See setup() for the details.
+*/
+class IslandEvolution : public Evolution
+{
+public:
+
+/**
+@brief Clone the current class.
+@sa clone_impl()
+*/
+    std::shared_ptr<IslandEvolution> clone() const
+    {
+        return std::dynamic_pointer_cast<IslandEvolution>(clone_impl());
+    }
+
+/**
+@brief Set up the internal states.
+
+If IslandEvolution has the following configuration:
+- max_generation: 10000
+- number_of_islands: 4
+- migration_interval: 25
+- number_of_migrants: 2
+- topology: ring
+.
+its configuration should be
+- JSON configuration
+@code
+"Evolution" : {
+    "classname" : "IslandEvolution",
+    "max_generation" : 10000,
+    "number_of_islands" : 4,
+    "migration_interval" : 25,
+    "number_of_migrants" : 2,
+    "topology" : "ring"
+}
+@endcode
+.
+*/
+    void setup(const Configuration& config,
+               const PrototypeManager& pm) override;
+
+/**
+@brief Evolve the islands and gather their results into @a repos.
+@exception std::logic_error The budget of FEs is less than the number of
+islands.
+*/
+    void evolve(std::shared_ptr<Repository> repos) const override;
+
+private:
+
+/// The queue of migrants between two islands.
+    using MigrationQueue = SpscQueue<std::shared_ptr<Individual>>;
+
+/**
+@brief Evolve an island until the termination.
+@param island The Repository of the island.
+@param outgoing The queues to send migrants.
+@param incoming The queues to receive migrants.
+@param terminated The flag shared by all islands to stop the evolution.
+*/
+    void evolve_island(std::shared_ptr<Repository> island,
+                       const std::vector<MigrationQueue*>& outgoing,
+                       const std::vector<MigrationQueue*>& incoming,
+                       std::atomic<bool>& terminated) const;
+
+/**
+@brief Evolve all islands in lockstep with synchronous migrations.
+*/
+    void evolve_synchronously(
+            const std::vector<std::shared_ptr<Repository>>& islands,
+            const std::vector<std::vector<MigrationQueue*>>& outgoing,
+            const std::vector<std::vector<MigrationQueue*>>& incoming) const;
+
+/**
+@brief Return whether an island which stops by @a reason also stops
+the other islands, which is all but "stagnation".
+@param reason The reason returned by Statistics::termination_reason().
+*/
+    bool stops_all_islands(const std::string& reason) const;
+
+/**
+@brief Call @a func for each island on its own thread and wait for them.
+
+The first exception thrown by @a func is rethrown.
+*/
+    void run_islands(const std::function<void(std::size_t)>& func) const;
+
+/**
+@brief Send copies of the best individuals to the neighbors.
+*/
+    void emigrate(std::shared_ptr<const Repository> island,
+                  const std::vector<MigrationQueue*>& outgoing) const;
+
+/**
+@brief Replace the worst individuals by the better immigrants.
+*/
+    void immigrate(std::shared_ptr<Repository> island,
+                   const std::vector<MigrationQueue*>& incoming) const;
+
+private:
+
+/// The number of islands.
+    unsigned int number_of_islands_;
+/// The number of generations between two migrations.
+    unsigned int migration_interval_;
+/// The number of individuals sent to each neighbor on migration.
+    unsigned int number_of_migrants_;
+/// The name of the topology.
+    std::string topology_;
+/// The indexes of neighbors which each island sends migrants to.
+    std::vector<std::vector<std::size_t>> neighbors_;
+
+private:
+
+    std::shared_ptr<Prototype> clone_impl() const override
+    {
+        return std::make_shared<IslandEvolution>(*this);
+    }
+};
+
+}
+
+#endif // ISLAND_EVOLUTION_H
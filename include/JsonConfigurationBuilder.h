@@ -11,6 +11,24 @@ namespace adef {
 /**
 @brief JsonConfigurationBuilder creates the configuration data
 in JSON format.
+
+A sweep is an object with the member "$sweep" or "$range":
+- <tt>{"$sweep" : [v1, v2, ...]}</tt> takes the values in order.
+- <tt>{"$range" : [start, stop, step]}</tt> takes the numbers from
+  @a start to @a stop (inclusive) by @a step. @a step is 1 if omitted.
+  The numbers are integers if all of them are integers.
+.
+Each sweep is one dimension of the cross product. The dimensions are
+ordered by the depth-first traversal (the members by name and
+the elements by index), and the last changes fastest. The sweeps with
+the same member "$axis" (a @c string) share one dimension, so they
+advance together and must have the same size.
+The values of a sweep are taken as they are, so a sweep in a sweep is
+not expanded.
+
+The label of a combination joins the member name and the value of
+each sweep whose value is a number, a @c string or a @c bool, e.g.,
+<tt>F0.5_CR0.9</tt>. The sweeps of objects or arrays are not labeled.
 */
 class JsonConfigurationBuilder : public ConfigurationBuilder
 {
@@ -66,6 +84,18 @@ public:
         unsigned int index,
         std::shared_ptr<const ConfigurationData> config_data) const override;
 
+/*
+    sweep
+*/
+    unsigned int get_sweep_size(
+        std::shared_ptr<const ConfigurationData> config_data) const override;
+    std::shared_ptr<ConfigurationData> get_sweep_config_data(
+        unsigned int index,
+        std::shared_ptr<const ConfigurationData> config_data) const override;
+    std::string get_sweep_label(
+        unsigned int index,
+        std::shared_ptr<const ConfigurationData> config_data) const override;
+
 /*
     value
 */
@@ -1,18 +1,38 @@
 #ifndef JSON_CONFIGURATION_DATA_H
 #define JSON_CONFIGURATION_DATA_H
 
+#include <memory>
+#include <utility>
 #include "ConfigurationData.h"
 #include "json.hpp"
 
 namespace adef {
 
 /**
-@brief JsonConfigurationData stores configuration data in JSON format.
+@brief JsonConfigurationData is the view of a JSON value in a document.
+
+The document is parsed once by JsonConfigurationBuilder::load_config()
+and shared by all views into it, so accessing a member or an element
+only points to the node without copying the JSON subtree.
+The document is immutable after loading, so the views are safe to
+share and to copy.
 */
 class JsonConfigurationData : public ConfigurationData
 {
 public:
 
+    JsonConfigurationData() = default;
+/**
+@brief Construct the view of the node in the document.
+@param document The document which owns the node.
+@param node The node. @c nullptr is the @c null value.
+*/
+    JsonConfigurationData(std::shared_ptr<const nlohmann::json> document,
+                          const nlohmann::json* node) :
+        document_(std::move(document)), node_(node)
+    {
+    }
+
 /**
 @brief Clone the current class.
 @sa clone_impl()
@@ -22,8 +42,31 @@ public:
         return std::static_pointer_cast<JsonConfigurationData>(clone_impl());
     }
 
-/// The JSON value.
-    nlohmann::json data;
+/**
+@brief Return the JSON value.
+*/
+    const nlohmann::json& data() const
+    {
+        static const nlohmann::json null_value;
+        return node_ ? *node_ : null_value;
+    }
+/**
+@brief Return the view of the child node in the same document.
+*/
+    std::shared_ptr<JsonConfigurationData> view(
+                                        const nlohmann::json* node) const
+    {
+        return std::make_shared<JsonConfigurationData>(document_, node);
+    }
+/**
+@brief Replace the document and view its root.
+*/
+    void reset(nlohmann::json&& document)
+    {
+        auto root = std::make_shared<const nlohmann::json>(std::move(document));
+        node_ = root.get();
+        document_ = std::move(root);
+    }
 
 private:
 
@@ -31,6 +74,11 @@ private:
     {
         return std::make_shared<JsonConfigurationData>(*this);
     }
+
+/// The document which owns the node.
+    std::shared_ptr<const nlohmann::json> document_;
+/// The JSON value.
+    const nlohmann::json* node_ = nullptr;
 };
 
 }
@@ -0,0 +1,103 @@
+#ifndef KNN_SURROGATE_H
+#define KNN_SURROGATE_H
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include "Surrogate.h"
+#include "util/kd_tree.h"
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+class Repository;
+class Individual;
+
+/**
+@brief KnnSurrogate predicts the fitness by the k nearest neighbors.
+
+It keeps an archive of the evaluated individuals in a KdTree, and
+the prediction is the average of the fitness of the nearest neighbors
+weighted by the inverse of the squared distances. Learning an individual
+inserts it into the tree. If the archive is full, the older half of it
+is removed, so the model follows the current region of the search.
+
+@par The configuration
+KnnSurrogate has extra configurations:
+- member (optional)
+    - name: "number_of_neighbors"
+    - value: <tt>unsigned int</tt>
+.
+- member (optional)
+    - name: "archive_size"
+    - value: <tt>unsigned int</tt>
+.
+It has default configurations:
+- number_of_neighbors: 5
+- archive_size: 1000
+.
+See setup() for the details.
+*/
+class KnnSurrogate : public Surrogate
+{
+public:
+
+/**
+@brief Clone the current class.
+@sa clone_impl()
+*/
+    std::shared_ptr<KnnSurrogate> clone() const
+    {
+        return std::dynamic_pointer_cast<KnnSurrogate>(clone_impl());
+    }
+/**
+@brief Set up the internal states.
+
+If KnnSurrogate has the following configuration:
+- number_of_neighbors: 5
+- archive_size: 1000
+- margin: 0.0
+.
+its configuration should be
+- JSON configuration
+@code
+"Surrogate": {
+    "classname" : "KnnSurrogate",
+    "number_of_neighbors" : 5,
+    "archive_size" : 1000,
+    "margin" : 0.0
+}
+@endcode
+.
+*/
+    void setup(const Configuration& config, const PrototypeManager& pm) override;
+
+    void init(std::shared_ptr<Repository> repos) override;
+
+    void learn(const Individual& individual) override;
+    bool predict(const Individual& individual, double& fitness) const override;
+    std::size_t number_of_samples() const override { return archive_.size(); }
+
+private:
+
+/// The number of the nearest neighbors to predict.
+    std::size_t number_of_neighbors_ = 5;
+/// The maximum number of the learned individuals.
+    std::size_t archive_size_ = 1000;
+/// The learned individuals and their fitness.
+    KdTree archive_;
+/// The result of the search, kept to avoid allocations.
+    mutable std::vector<KdTree::Neighbor> neighbors_;
+
+private:
+
+    std::shared_ptr<Prototype> clone_impl() const override
+    {
+        return std::make_shared<KnnSurrogate>(*this);
+    }
+};
+
+}
+
+#endif // KNN_SURROGATE_H
@@ -0,0 +1,46 @@
+#ifndef PLUGIN_LOADER_H
+#define PLUGIN_LOADER_H
+
+#include <string>
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+
+/**
+@brief Load the plugins listed in the configuration.
+
+The configuration is the root of the configuration file, and its
+"plugins" is the path or the array of paths of the shared libraries,
+e.g.,
+@code
+{
+    "plugins" : [ "./libmyproblems.so" ],
+    "System" : { ... }
+}
+@endcode
+Nothing is loaded if it has no "plugins".
+@param config The root configuration.
+@param pm The PrototypeManager to register the problems of the plugins.
+@sa load_plugin()
+*/
+void load_plugins(const Configuration& config, PrototypeManager& pm);
+
+/**
+@brief Load the plugin.
+
+The shared library is loaded and never unloaded. Its C++ prototypes
+registered by ADEF_REGISTER_TYPE() are registered when it is loaded.
+If it exports the entry point of adef_plugin.h, each of its problems is
+registered to @a pm as a PluginProblem by the classname.
+@param path The path of the shared library.
+@param pm The PrototypeManager to register the problems.
+@exception std::runtime_error The plugin can not be loaded, it has the
+different ABI version, or the plugins are not supported.
+*/
+void load_plugin(const std::string& path, PrototypeManager& pm);
+
+}
+
+#endif // PLUGIN_LOADER_H
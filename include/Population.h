@@ -86,6 +86,15 @@ its configuration should be
 */
     void replace(std::shared_ptr<const Population> rhs);
 /**
+@brief Make the population hold some individuals of other.
+
+The individuals are shared with @a rhs, not copied, so the population is
+a view which changes the individuals of @a rhs.
+@param rhs The population which holds the individuals.
+@param indexes The indexes of the individuals in @a rhs.
+*/
+    void share(Population& rhs, const std::vector<std::size_t>& indexes);
+/**
 @name Individual operators
 The operators of accessing individuals.
 */
@@ -103,7 +112,7 @@ The operators of accessing individuals.
 @brief Access the individual with bounds checking.
 @param index The index of individual.
 */
-    std::shared_ptr<Individual> at(std::size_t index);
+    const std::shared_ptr<Individual>& at(std::size_t index);
 /**
 @brief Access the individual with bounds checking.
 @param index The index of individual.
@@ -113,12 +122,28 @@ The operators of accessing individuals.
 @brief Access the individual.
 @param index The index of individual.
 */
-    std::shared_ptr<Individual> operator[](std::size_t index);
+    const std::shared_ptr<Individual>& operator[](std::size_t index);
 /**
 @brief Access the individual.
 @param index The index of individual.
 */
     std::shared_ptr<const Individual> operator[](std::size_t index) const;
+/**
+@brief Access the individual by reference with bounds checking.
+
+It is used by the per-individual operations, which do not need
+to share the individual.
+@param index The index of individual.
+*/
+    Individual& individual(std::size_t index) { return *individuals_.at(index); }
+/**
+@brief Access the individual by reference with bounds checking.
+@param index The index of individual.
+*/
+    const Individual& individual(std::size_t index) const
+    {
+        return *individuals_.at(index);
+    }
 ///@}
 
 /**
@@ -109,7 +109,29 @@ its configuration should be
     virtual void setup(const Configuration& config,
                        const PrototypeManager& pm) override;
 
+/**
+@brief Initialize the Problem.
+
+It takes the random generator of the run only if the Problem is not
+shareable.
+*/
     virtual void init(std::shared_ptr<Repository> repos) override;
+/**
+@brief Return whether the Problem is shared by the runs.
+
+The definition of the Problem does not change after setup(), so it is
+shared by default. The Problem which uses the random generator, e.g.,
+the noisy one, must return @c false.
+*/
+    virtual bool is_shareable() const override { return true; }
+/**
+@brief Return whether the same individual is always evaluated to the same
+objectives.
+
+Evaluator reuses the results of evaluations only if it is @c true.
+The noisy Problem must return @c false.
+*/
+    virtual bool is_deterministic() const { return true; }
 
 /**
 @brief Evaluate the individual.
@@ -118,13 +140,97 @@ its configuration should be
 Evaluate the individual and increase the Problem::number_of_fitness_evaluations.
 @sa evaluation_function()
 */
-    void evaluate(std::shared_ptr<Individual> individual) const;
+    void evaluate(Individual& individual) const;
+/**
+@brief Evaluate the individual.
+@sa evaluate(Individual&)
+*/
+    void evaluate(std::shared_ptr<Individual> individual) const
+    {
+        evaluate(*individual);
+    }
+/**
+@brief Evaluate the individuals together.
+
+It evaluates them one by one by default. The Problem which evaluates
+more efficiently in batches, e.g., ProcessProblem, overrides it.
+@param individuals The individuals to be evaluated.
+*/
+    virtual void evaluate_batch(const std::vector<Individual*>& individuals) const;
 
 /**
 @brief Evaluate the individual by the given function.
 @param individual The individual to be evaluated.
 */
-    virtual void evaluation_function(std::shared_ptr<Individual> individual) const = 0;
+    virtual void evaluation_function(Individual& individual) const = 0;
+
+/**
+@name Separable evaluation
+
+A separable Problem computes its objectives from sums, each term of
+which depends on one decision variable, e.g., the Sphere function.
+An individual which differs from its target in @em k of @em D decision
+variables is evaluated from the terms of the target by O(k) instead of
+O(D) evaluations of terms. Copying the terms of the target and finding
+the changed decision variables still cost O(D) memory traffic, so it pays
+off for the Problem whose terms are expensive, e.g., with trigonometric
+functions. See evaluate_partially().
+*/
+///@{
+/**
+@brief Return the number of the sums, or zero if the Problem is not
+separable.
+*/
+    virtual std::size_t number_of_separable_sums() const { return 0; }
+/**
+@brief Compute the terms of all sums for a decision variable.
+@param variable The value of the decision variable.
+@param dimension The dimension of the decision variable.
+@param terms The number_of_separable_sums() terms to store.
+*/
+    virtual void separable_terms(Object variable, std::size_t dimension,
+                                 Object* terms) const;
+/**
+@brief Set the objectives and the fitness from the sums.
+@param sums The number_of_separable_sums() sums.
+@param individual The individual to be evaluated.
+*/
+    virtual void separable_objectives(const Object* sums,
+                                      Individual& individual) const;
+/**
+@brief Evaluate the individual and store the terms and the sums into it.
+
+The result is the same as evaluate().
+@exception std::logic_error The Problem is not separable.
+*/
+    void evaluate_separably(Individual& individual) const;
+/**
+@brief Evaluate the individual from the terms of its target.
+
+The terms and the sums of @a target are copied into @a individual, and
+only the terms of @a changed_indexes are computed again. The sums are
+updated by the differences of the terms of the changed
+decision variables, so they may differ from evaluate_separably() by
+the rounding errors. Each sum keeps the magnitude of the terms added
+to and subtracted from it since it was computed from scratch, which
+bounds its rounding error. If the magnitude exceeds the dimension times
+the sum, the individual is evaluated by evaluate_separably() instead,
+so the error stays of the same order as that of the evaluation from
+scratch.
+@param individual The individual to be evaluated.
+@param target The target which has the terms, see has_separable_terms().
+@param changed_indexes The dimensions in which the decision variables of
+       @a individual differ from @a target.
+@exception std::logic_error The target has no terms.
+*/
+    void evaluate_partially(Individual& individual,
+                            const Individual& target,
+                            const std::vector<std::size_t>& changed_indexes) const;
+/**
+@brief Return whether the individual has the terms of the Problem.
+*/
+    bool has_separable_terms(const Individual& individual) const;
+///@}
 
 /**
 @brief Return the name of the problem.
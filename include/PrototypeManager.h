@@ -1,9 +1,10 @@
 #ifndef PROTOTYPE_MANAGER_H
 #define PROTOTYPE_MANAGER_H
 
-#include <map>
+#include <unordered_map>
 #include <string>
 #include <memory>
+#include <functional>
 
 namespace adef {
 
@@ -13,8 +14,12 @@ class Configuration;
 /**
 @brief PrototypeManager implements the simple mechanism of C++ reflection.
 
-PrototypeManager manages name-pointer pairs to create a class
-pointer from the registered name.
+PrototypeManager manages name-factory pairs to create a class
+pointer from the registered name. The names are hashed, and the class
+is constructed only when it is made.
+
+The types registered by ADEF_REGISTER_TYPE() are shared by all managers.
+They are found if the name is not registered to the manager itself.
 
 @sa Prototype
 */
@@ -22,14 +27,45 @@ class PrototypeManager
 {
 public:
 
+/// The function which creates a class pointer.
+    using Factory = std::function<std::shared_ptr<Prototype>()>;
+
 /**
 @brief Register a class by the name.
 
+The class is cloned when it is made.
 @param name The class name to register.
 @param type The class pointer to register.
 */
     void register_type(const std::string& name,
                        std::shared_ptr<Prototype> type);
+/**
+@brief Register a class by the name and its factory.
+
+@param name The class name to register.
+@param factory The factory to create the class.
+*/
+    void register_type(const std::string& name, Factory factory);
+/**
+@brief Register a class by the name. The class is default constructed
+when it is made.
+@tparam T The type to register.
+@param name The class name to register.
+*/
+    template<typename T>
+    void register_type(const std::string& name)
+    {
+        register_type(name, Factory(&make_default<T>));
+    }
+/**
+@brief Register a class by the name to all managers.
+
+It is used by ADEF_REGISTER_TYPE().
+@param name The class name to register.
+@param factory The factory to create the class.
+*/
+    static void register_global_type(const std::string& name,
+                                     Factory factory);
 
 /**
 @brief Create a class pointer according to the registered name.
@@ -50,15 +86,62 @@ public:
         return std::dynamic_pointer_cast<T>(make_type(name));
     }
 
+/**
+@brief Return the default constructed @a T.
+*/
+    template<typename T>
+    static std::shared_ptr<Prototype> make_default()
+    {
+        return std::make_shared<T>();
+    }
+
 private:
 
 /**
-@brief The class name-pointer pairs.
+@brief The class name-factory pairs.
+*/
+    std::unordered_map<std::string, Factory> table_of_type_;
+
+};
+
+/**
+@brief TypeRegistrar registers a class to all PrototypeManager
+when it is constructed.
+
+@sa ADEF_REGISTER_TYPE()
 */
-    std::map<std::string, std::shared_ptr<Prototype>> table_of_type_;
+class TypeRegistrar
+{
+public:
 
+    TypeRegistrar(const std::string& name, PrototypeManager::Factory factory)
+    {
+        PrototypeManager::register_global_type(name, std::move(factory));
+    }
 };
 
+#define ADEF_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define ADEF_CONCAT(lhs, rhs) ADEF_CONCAT_IMPL(lhs, rhs)
+
+/**
+@brief Register the class by the name to all PrototypeManager
+before @c main() or when the shared library is loaded.
+
+Use it at namespace scope in the source file, e.g.,
+@code
+ADEF_REGISTER_TYPE("MyProblem", MyProblem);
+@endcode
+Note that the linker drops an object file of a static library which
+is not referenced, so the source file should be compiled into
+the executable or a shared library.
+@param name The class name to register.
+@param type The type to register. It must be default constructible.
+*/
+#define ADEF_REGISTER_TYPE(name, type)                                      \
+    static const ::adef::TypeRegistrar                                      \
+        ADEF_CONCAT(adef_type_registrar_, __LINE__)(                       \
+            name, &::adef::PrototypeManager::make_default<type>)
+
 /**
 @brief Create and set up a class by specifying the name
 from the configuration and manager.
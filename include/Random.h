@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <random>
+#include <initializer_list>
 #include "Prototype.h"
 
 namespace adef {
@@ -23,6 +24,11 @@ class Random : public Prototype
 public:
 
     Random();
+/**
+@brief Construct the generator with the specific seed.
+@param seed The seed of the generator.
+*/
+    explicit Random(unsigned int seed);
     Random(const Random& rhs);
     virtual ~Random() = default;
     Random& operator=(const Random& rhs) = delete;
@@ -52,13 +58,47 @@ Random has the following configuration:
 
     unsigned int seed() const { return seed_; }
 
-    int random() const;
+/**
+@brief Return a pseudo-random integer in <tt>[0, RAND_MAX]</tt>.
+
+It is drawn from the internal generator rather than @c std::rand(),
+so that each Random can be used on its own thread.
+*/
+    int random();
+
+/**
+@brief Create an independent generator derived from this seed.
+@param index The index of the substream.
+*/
+    std::shared_ptr<Random> substream(unsigned int index) const;
+/**
+@brief Create an independent generator derived from this seed and a key.
+
+The same seed and key always give the same generator, so the key can
+describe logical coordinates such as (generation, individual).
+@param key The key of the substream.
+*/
+    std::shared_ptr<Random> substream(
+                        std::initializer_list<unsigned int> key) const;
 
     template<typename Distribution>
     typename Distribution::result_type generate(Distribution distribution)
     {
         return distribution(generator_);
     }
+/**
+@brief Generate a number from @a distribution with the parameters @a param.
+
+The same @a distribution can be reused with different parameters,
+which keeps its internal states such as the cached normal number.
+*/
+    template<typename Distribution>
+    typename Distribution::result_type generate(
+                            Distribution& distribution,
+                            const typename Distribution::param_type& param)
+    {
+        return distribution(generator_, param);
+    }
 
 protected:
 
@@ -57,17 +57,25 @@ If @em Class is derived from Repair, its configuration should be
 @param individual The individual to be repaired.
 @param problem The Problem which has the definition.
 */
-    virtual void repair(std::shared_ptr<Individual> individual,
-                        std::shared_ptr<const Problem> problem) const;
+    virtual void repair(Individual& individual, const Problem& problem) const;
+/**
+@brief Repair infeasible solution according to the problem.
+@sa repair(Individual&, const Problem&)
+*/
+    void repair(std::shared_ptr<Individual> individual,
+                std::shared_ptr<const Problem> problem) const
+    {
+        repair(*individual, *problem);
+    }
 /**
 @brief Repair infeasible solution by given function.
 @param individual The individual to be repaired.
 @param dimension The value of individual be repaired on specific dimension.
 @param problem The Problem which has the definition.
 */
-    virtual void repair_function(std::shared_ptr<Individual> individual,
+    virtual void repair_function(Individual& individual,
                                  std::size_t dimension,
-                                 std::shared_ptr<const Problem> problem) const = 0;
+                                 const Problem& problem) const = 0;
 
 protected:
 
@@ -78,8 +86,8 @@ protected:
 @param dimension The value of individual be repaired on specific dimension.
 */
     double find_nearest_bound(double gene,
-                         std::shared_ptr<const Problem> problem,
-                         std::size_t dimension) const;
+                              const Problem& problem,
+                              std::size_t dimension) const;
 
 private:
 
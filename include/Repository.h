@@ -3,7 +3,11 @@
 
 #include <memory>
 #include <string>
+#include <vector>
+#include <functional>
+#include <cstddef>
 #include "Prototype.h"
+#include "IndividualContext.h"
 
 namespace adef {
 
@@ -15,6 +19,7 @@ class Statistics;
 class Parameters;
 class Initializer;
 class Evaluator;
+class Surrogate;
 class Population;
 class Reproduction;
 class EnvironmentalSelection;
@@ -22,6 +27,7 @@ class Mutation;
 class Crossover;
 class Repair;
 class Random;
+class ThreadPool;
 
 /**
 @brief Repository contains informations of the algorithm.
@@ -56,6 +62,9 @@ Repository has extra configurations:
 - member
     - name: "Evaluator"
     - value: object configurations which represents Evaluator.
+- member (optional)
+    - name: "Surrogate"
+    - value: object configurations which represents Surrogate.
 - member
     - name: "Population"
     - value: object configurations which represents Population.
@@ -74,7 +83,23 @@ Repository has extra configurations:
 - member
     - name: "Repair"
     - value: object configurations which represents Repair.
+- member (optional)
+    - name: "number_of_threads"
+    - value: <tt>unsigned int</tt>
+- member (optional)
+    - name: "deterministic"
+    - value: @c bool
 .
+It has default configurations:
+- Surrogate: none, i.e., all offspring are evaluated.
+- number_of_threads: 1
+- deterministic: false
+.
+
+If "deterministic" is @c true, the random generator used for an individual
+in for_each_individual() is keyed by the run, the generation and the index
+of the individual instead of by the thread, so the results do not depend
+on "number_of_threads".
 See setup() for the details.
 
 @sa See System and Experiment for which contains.
@@ -155,50 +180,102 @@ its configuration should be
 */
     virtual void init(std::shared_ptr<Random> random);
 
+/**
+@brief Inform the beginning of a generation.
+
+In the deterministic mode, the random generators of individuals
+are derived again from the @a generation.
+@param generation The current generation, 0 for the initialization.
+*/
+    void begin_generation(unsigned int generation);
+
+/**
+@brief Return the context of the individual processed on the calling thread.
+@param index The index of the target individual.
+*/
+    IndividualContext context(std::size_t index) const;
+
+/**
+@brief Apply a function to the context of each individual across threads.
+
+The individuals are split into contiguous blocks, one for each thread,
+and each thread uses its own random generator in the context.
+The function must only touch the states of its own individual.
+@param size The number of individuals.
+@param func The function to apply.
+*/
+    void for_each_individual(
+            std::size_t size,
+            const std::function<void(const IndividualContext&)>& func);
+
+/// Return the number of threads used in for_each_individual().
+    unsigned int number_of_threads() const { return number_of_threads_; }
+/**
+@brief Set the number of threads used in for_each_individual().
+
+It takes effect on the next init().
+*/
+    void set_number_of_threads(unsigned int number_of_threads)
+    {
+        number_of_threads_ = number_of_threads > 0 ? number_of_threads : 1;
+    }
+/// Return whether the results are independent of the number of threads.
+    bool is_deterministic() const { return deterministic_; }
+
 
 /// Return the name of the algorithm.
     const std::string& algorithm_name() const { return algorithm_name_; }
+/// Set the name of the algorithm.
+    void set_algorithm_name(const std::string& algorithm_name)
+    {
+        algorithm_name_ = algorithm_name;
+    }
 
-    std::shared_ptr<Random> random() { return random_; }
+    const std::shared_ptr<Random>& random() { return random_; }
     std::shared_ptr<const Random> random() const { return random_; }
 
 /**
 @name evolutionary states access
+The non-const accessors return the reference to the pointer,
+so they do not copy it.
 */
 ///@{
-    std::shared_ptr<Evolution> evolution() { return evolution_; }
+    const std::shared_ptr<Evolution>& evolution() { return evolution_; }
     std::shared_ptr<const Evolution> evolution() const { return evolution_; }
 
-    std::shared_ptr<Problem> problem() { return problem_; }
+    const std::shared_ptr<Problem>& problem() { return problem_; }
     std::shared_ptr<const Problem> problem() const { return problem_; }
-    std::shared_ptr<Statistics> statistics() { return statistics_; }
+    const std::shared_ptr<Statistics>& statistics() { return statistics_; }
     std::shared_ptr<const Statistics> statistics() const { return statistics_; }
-    std::shared_ptr<Parameters> parameters() { return parameters_; }
+    const std::shared_ptr<Parameters>& parameters() { return parameters_; }
     std::shared_ptr<const Parameters> parameters() const { return parameters_; }
 
-    std::shared_ptr<Initializer> initializer() { return initializer_; }
+    const std::shared_ptr<Initializer>& initializer() { return initializer_; }
     std::shared_ptr<const Initializer> initializer() const {
         return initializer_; }
-    std::shared_ptr<Evaluator> evaluator() { return evaluator_; }
+    const std::shared_ptr<Evaluator>& evaluator() { return evaluator_; }
     std::shared_ptr<const Evaluator> evaluator() const { return evaluator_; }
+/// Return the Surrogate, or @c nullptr if it is not configured.
+    const std::shared_ptr<Surrogate>& surrogate() { return surrogate_; }
+    std::shared_ptr<const Surrogate> surrogate() const { return surrogate_; }
 
-    std::shared_ptr<Population> population() { return population_; }
+    const std::shared_ptr<Population>& population() { return population_; }
     std::shared_ptr<const Population> population() const { return population_; }
-    std::shared_ptr<Population> offspring() { return offspring_; }
+    const std::shared_ptr<Population>& offspring() { return offspring_; }
     std::shared_ptr<const Population> offspring() const { return offspring_; }
 
-    std::shared_ptr<Reproduction> reproduction() { return reproduction_; }
+    const std::shared_ptr<Reproduction>& reproduction() { return reproduction_; }
     std::shared_ptr<const Reproduction> reproduction() const {
         return reproduction_; }
-    std::shared_ptr<EnvironmentalSelection> environmental_selection() {
+    const std::shared_ptr<EnvironmentalSelection>& environmental_selection() {
         return environmental_selection_; }
     std::shared_ptr<const EnvironmentalSelection>
         environmental_selection() const { return environmental_selection_; }
-    std::shared_ptr<Mutation> mutation() { return mutation_; }
+    const std::shared_ptr<Mutation>& mutation() { return mutation_; }
     std::shared_ptr<const Mutation> mutation() const { return mutation_; }
-    std::shared_ptr<Crossover> crossover() { return crossover_; }
+    const std::shared_ptr<Crossover>& crossover() { return crossover_; }
     std::shared_ptr<const Crossover> crossover() const { return crossover_; }
-    std::shared_ptr<Repair> repair() { return repair_; }
+    const std::shared_ptr<Repair>& repair() { return repair_; }
     std::shared_ptr<const Repair> repair() const { return repair_; }
 ///@}
 
@@ -226,6 +303,8 @@ other evolutionary states.
     std::shared_ptr<Initializer> initializer_;
 /// The evaluator to evaluate individuals.
     std::shared_ptr<Evaluator> evaluator_;
+/// The surrogate to pre-screen offspring, which may be @c nullptr.
+    std::shared_ptr<Surrogate> surrogate_;
 /// The population held in evolution process.
     std::shared_ptr<Population> population_;
 /// The offspring produced by the population.
@@ -241,6 +320,19 @@ other evolutionary states.
 /// The repair process to repair individuals that are illegal.
     std::shared_ptr<Repair> repair_;
 
+/// The number of threads to process individuals.
+    unsigned int number_of_threads_;
+/// The threads to process individuals, created in init().
+    std::shared_ptr<ThreadPool> thread_pool_;
+/// The random generator of each thread, created in init().
+    std::vector<std::shared_ptr<Random>> thread_randoms_;
+/// The flag of the deterministic mode.
+    bool deterministic_;
+/// The current generation informed by begin_generation().
+    unsigned int generation_;
+/// The random generator of each individual in the deterministic mode.
+    std::vector<std::shared_ptr<Random>> individual_randoms_;
+
 private:
 
     virtual std::shared_ptr<Prototype> clone_impl() const override
@@ -5,6 +5,8 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <chrono>
+#include <cstddef>
 #include "Prototype.h"
 #include "EvolutionaryState.h"
 
@@ -20,19 +22,51 @@ class Population;
 
 Statistics collects the data of each generation, including
 1. the number of the fitness evaluations (FEs)
-2. the best fitness
-3. the best fitness so far
-4. Statistics::Item of all individuals
+2. the number of the evaluations reused by Evaluator (cache hits)
+3. the number of the evaluations saved by Surrogate
+4. the best fitness
+5. the best fitness so far
+6. Statistics::Item of all individuals
 .
 For the statistics of Statistics::Item, it can be configured by the
 configuration file to specify which items can be collected and output.
 
+Statistics also decides the termination of the evolution except
+the maximum of generation, see termination_reason(). The evolution stops
+when any of the following criteria is satisfied:
+- "success": the error of the best fitness so far is less than
+  "success_error".
+- "max_fitness_evaluations": the number of FEs reaches the budget.
+  Evaluator does not evaluate more individuals than the budget, so it is
+  never overshot even in the middle of a generation.
+- "time_limit": the seconds since init() exceed the limit.
+- "stagnation": the best fitness so far is not improved more than
+  "stagnation_epsilon" in "stagnation_generations" generations.
+.
+The reason why the evolution stops is recorded by set_stop_reason().
+
 @par The configuration
 Statistics has extra configurations:
 - member (optional)
     - name: "success_error"
     - value: @c double
 .
+- member (optional)
+    - name: "max_fitness_evaluations"
+    - value: <tt>unsigned int</tt>
+.
+- member (optional)
+    - name: "time_limit"
+    - value: @c double
+.
+- member (optional)
+    - name: "stagnation_generations"
+    - value: <tt>unsigned int</tt>
+.
+- member (optional)
+    - name: "stagnation_epsilon"
+    - value: @c double
+.
 - member
     - name: "item"
     - value: array configuration
@@ -40,6 +74,10 @@ Statistics has extra configurations:
 .
 It has default configurations:
 - success_error: 0.00001
+- max_fitness_evaluations: 0, i.e., no budget.
+- time_limit: 0, i.e., no limit.
+- stagnation_generations: 0, i.e., no stagnation check.
+- stagnation_epsilon: 0
 .
 See setup() for the details.
 */
@@ -80,6 +118,8 @@ public:
 
 If Statistics has the following configuration:
 - item: parents, offspring, f, cr
+- max_fitness_evaluations: 300000
+- time_limit: 60 seconds
 .
 its configuration should be
 - JSON configuration
@@ -91,14 +131,18 @@ its configuration should be
         "offspring",
         "f",
         "cr"
-    ]
+    ],
+    "max_fitness_evaluations" : 300000,
+    "time_limit" : 60
 }
 @endcode
 .
 */
     virtual void setup(const Configuration& config,
                        const PrototypeManager& pm) override;
-
+/**
+@brief Start the clock of the time limit.
+*/
     virtual void init(std::shared_ptr<Repository> repos) override;
 
 /**
@@ -117,6 +161,16 @@ its configuration should be
     void store_statistics_all_individuals(Item item,
                                         const AllIndividualsValueList& values);
 /**
+@brief Merge the statistics of another evolution which runs side by side.
+
+The best fitness of each generation and the best fitness so far keep
+the better one, the number of fitness evaluations, cache hits and saved
+evaluations are accumulated, and values of the statistical items are
+concatenated on each generation.
+@param rhs The statistics to merge.
+*/
+    void merge(const Statistics& rhs);
+/**
 @brief Output the statistics.
 @param prefix The prefix of the file name.
 */
@@ -127,6 +181,12 @@ its configuration should be
 */
     bool is_evolve_success(std::shared_ptr<const Repository> repos) const;
 /**
+@brief Return the criterion by which the evolution should stop.
+@return "success", "max_fitness_evaluations", "time_limit" or
+        "stagnation", or the empty string if the evolution goes on.
+*/
+    std::string termination_reason(std::shared_ptr<const Repository> repos) const;
+/**
 @brief Return the error between the experimental data and the optimal value.
 */
     double evolve_error(std::shared_ptr<const Repository> repos) const;
@@ -158,6 +218,72 @@ its configuration should be
     {
         return number_of_fitness_evaluations_;
     }
+/**
+@brief Return the number of fitness evaluations left in the budget,
+or the maximum of <tt>unsigned int</tt> if there is no budget.
+*/
+    unsigned int remaining_fitness_evaluations() const;
+/**
+@brief Return the budget of fitness evaluations, or zero if there is
+no budget.
+*/
+    unsigned int max_fitness_evaluations() const
+    {
+        return max_fitness_evaluations_;
+    }
+/**
+@brief Set the budget of fitness evaluations, e.g., the share of
+an island.
+@param max_fitness_evaluations The budget, or zero for no budget.
+*/
+    void set_max_fitness_evaluations(unsigned int max_fitness_evaluations)
+    {
+        max_fitness_evaluations_ = max_fitness_evaluations;
+    }
+/**
+@brief Return the seconds since init().
+*/
+    double elapsed_time() const;
+/**
+@brief Record the reason why the evolution stops.
+@param reason "max_generation" or one of termination_reason().
+*/
+    void set_stop_reason(const std::string& reason) { stop_reason_ = reason; }
+/**
+@brief Return the reason why the evolution stops, or the empty string if
+it does not stop yet.
+*/
+    const std::string& stop_reason() const { return stop_reason_; }
+/**
+@brief Increase the number of the evaluations reused by Evaluator,
+which are not fitness evaluations.
+*/
+    void increase_number_of_cache_hits()
+    {
+        ++number_of_cache_hits_;
+    }
+/**
+@brief Return the number of the evaluations reused by Evaluator.
+*/
+    unsigned int number_of_cache_hits() const
+    {
+        return number_of_cache_hits_;
+    }
+/**
+@brief Increase the number of the offspring discarded by Surrogate
+without the fitness evaluations.
+*/
+    void increase_number_of_saved_evaluations()
+    {
+        ++number_of_saved_evaluations_;
+    }
+/**
+@brief Return the number of the evaluations saved by Surrogate.
+*/
+    unsigned int number_of_saved_evaluations() const
+    {
+        return number_of_saved_evaluations_;
+    }
 
 protected:
 
@@ -194,11 +320,19 @@ protected:
 
 /// The success error between solution and optimal solution.
     double success_error_;
+/// The budget of the fitness evaluations, 0 for no budget.
+    unsigned int max_fitness_evaluations_;
+/// The seconds of the time limit, 0 for no limit.
+    double time_limit_;
+/// The generations without improvement to stagnate, 0 for no check.
+    unsigned int stagnation_generations_;
+/// The improvement which is not regarded as stagnation.
+    double stagnation_epsilon_;
 
 /// The map of Item-name pairs.
-    std::map<Item, std::string> map_item_to_name_;
-/// The names of the statistical items.
-    std::vector<std::string> names_of_items_;
+    static const std::map<Item, std::string>& map_item_to_name();
+/// The names of the statistical items, shared by the copies.
+    std::shared_ptr<const std::vector<std::string>> names_of_items_;
 
 /// The statistics of values of all individuals.
     std::map<Item,
@@ -211,6 +345,18 @@ protected:
     double best_fitness_so_far_;
 /// The number of the fitness evaluations.
     unsigned int number_of_fitness_evaluations_;
+/// The number of the evaluations reused by Evaluator.
+    unsigned int number_of_cache_hits_;
+/// The number of the evaluations saved by Surrogate.
+    unsigned int number_of_saved_evaluations_;
+/// The time when the evolution starts.
+    std::chrono::steady_clock::time_point start_time_;
+/// The best fitness so far at the latest improvement.
+    double stagnation_fitness_;
+/// The generation of the latest improvement.
+    std::size_t stagnation_generation_;
+/// The reason why the evolution stops.
+    std::string stop_reason_;
 
 private:
 
@@ -0,0 +1,111 @@
+#ifndef SURROGATE_H
+#define SURROGATE_H
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include "Prototype.h"
+#include "EvolutionaryState.h"
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+class Repository;
+class Individual;
+
+/**
+@brief Surrogate pre-screens the offspring before the fitness evaluation.
+
+Surrogate learns the evaluated individuals and predicts the fitness of
+each offspring. The offspring which is predicted to lose against its
+target by the margin is discarded: it becomes the copy of its target and
+is not evaluated. The others are evaluated by Evaluator and learned.
+The discarded offspring are counted by
+Statistics::increase_number_of_saved_evaluations().
+
+The offspring is discarded if
+<tt>predicted > target + margin * |target|</tt>,
+so a positive margin keeps the offspring which are slightly worse than
+their targets by the prediction.
+
+The derived class implements the model by learn() and predict().
+
+@par The configuration
+Surrogate has extra configurations:
+- member (optional)
+    - name: "margin"
+    - value: @c double
+.
+It has default configurations:
+- margin: 0.0
+.
+See setup() for the details.
+*/
+class Surrogate : public Prototype, public EvolutionaryState
+{
+public:
+
+    virtual ~Surrogate() = default;
+
+/**
+@brief Clone the current class.
+@sa clone_impl()
+*/
+    std::shared_ptr<Surrogate> clone() const
+    {
+        return std::dynamic_pointer_cast<Surrogate>(clone_impl());
+    }
+/**
+@brief Set up the internal states.
+
+If @em Class is derived from Surrogate, its configuration should be
+- JSON configuration
+@code
+"Surrogate": {
+    "classname" : "Class",
+    "margin" : 0.0
+}
+@endcode
+.
+*/
+    virtual void setup(const Configuration& config,
+                       const PrototypeManager& pm) override;
+
+/**
+@brief Discard the offspring predicted to lose and evaluate the others.
+@param repos The Repository which contains the offspring.
+*/
+    virtual void evaluate(std::shared_ptr<Repository> repos);
+
+/**
+@brief Learn the evaluated individual.
+*/
+    virtual void learn(const Individual& individual) = 0;
+/**
+@brief Predict the fitness of the individual.
+@param individual The individual to predict.
+@param fitness The predicted fitness.
+@return False if the model can not predict yet.
+*/
+    virtual bool predict(const Individual& individual, double& fitness) const = 0;
+/**
+@brief Return the number of the learned individuals.
+*/
+    virtual std::size_t number_of_samples() const = 0;
+
+protected:
+
+/// The relative margin to discard the offspring.
+    double margin_ = 0.0;
+/// The indexes of the offspring to evaluate.
+    std::vector<std::size_t> kept_indexes_;
+
+private:
+
+    virtual std::shared_ptr<Prototype> clone_impl() const override = 0;
+};
+
+}
+
+#endif // SURROGATE_H
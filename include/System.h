@@ -4,13 +4,14 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <cstddef>
 #include "Prototype.h"
+#include "Configuration.h"
 
 namespace adef {
 
 class SystemStatistics;
 class Experiment;
-class Configuration;
 class PrototypeManager;
 
 /**
@@ -33,6 +34,8 @@ System has extra configurations:
     - name: "Experiment"
     - value: array configuration
         - elements: object configuration which represents Experiment.
+          It may contain sweeps (see JsonConfigurationBuilder), then it
+          represents one Experiment for each combination of the sweeps.
 .
 See setup() for the details.
 
@@ -76,19 +79,55 @@ its configuration should be
 }
 @endcode
 .
+The Experiment are not created here. It keeps their configurations and
+expands the sweeps lazily in run(), so the startup time and the memory
+do not depend on the number of combinations.
 */
     virtual void setup(const Configuration& config,
                        const PrototypeManager& pm) override;
 /**
 @brief Execute experiments.
 
-It calls Experiment::run() to execute each experiment. After finishing
-all of experiments, it outputs the statistics of entire experiments.
+It creates each experiment when it is scheduled and calls
+Experiment::run() to execute it. The experiment is released after
+its statistics are taken. After finishing all of experiments,
+it outputs the statistics of entire experiments.
+
+The label of the sweeps of scalar values, e.g., <tt>F0.5_CR0.9</tt>,
+is appended to the algorithm name of each combination, so
+the combinations have their own outputs, see
+Configuration::get_sweep_label().
+@exception std::logic_error Two experiments have the same name, e.g.,
+the sweep of objects which does not change the names.
 */
     virtual void run();
 
+/**
+@brief Return the number of experiments, including all combinations
+of the sweeps.
+*/
+    std::size_t number_of_experiments() const;
+/**
+@brief Create and set up the experiment.
+@param index The index in [0, number_of_experiments()), in the order
+of run().
+@exception std::out_of_range @a index is not less than
+number_of_experiments().
+*/
+    std::shared_ptr<Experiment> make_experiment(std::size_t index) const;
+
 protected:
 
+/**
+@brief Create and set up the experiment of the combination of sweeps,
+labeled by the swept values.
+@param config_index The index of the configuration of experiments.
+@param combination The index of the combination of sweeps.
+*/
+    std::shared_ptr<Experiment> make_experiment(
+                                    std::size_t config_index,
+                                    unsigned int combination) const;
+
 /**
 @brief The prefix of the file name of output data.
 */
@@ -98,9 +137,17 @@ protected:
 */
     std::shared_ptr<SystemStatistics> statistics_;
 /**
-@brief The total experiments.
+@brief The configurations of experiments, which may contain sweeps.
+*/
+    std::vector<Configuration> experiment_configs_;
+/**
+@brief The number of experiments of each configuration.
+*/
+    std::vector<unsigned int> number_of_experiments_;
+/**
+@brief The PrototypeManager to create experiments in run().
 */
-    std::vector<std::shared_ptr<Experiment>> experiments_;
+    std::shared_ptr<const PrototypeManager> pm_;
 
 private:
 
@@ -10,6 +10,7 @@ The API documentation.
 */
 
 #include <memory>
+#include <string>
 #include "System.h"
 
 /// namespace for ADEF
@@ -22,6 +23,15 @@ namespace adef {
 @return The System of ADEF to use.
 */
 std::shared_ptr<System> init_adef(int argc, char *argv[]);
+/**
+@brief Create the System from the configuration file.
+
+The types of ADEF and of the plugins in the configuration are
+registered.
+@param config_file The path of the configuration file.
+@return The System of ADEF to use.
+*/
+std::shared_ptr<System> make_system(const std::string& config_file);
 
 }
 
@@ -0,0 +1,71 @@
+#ifndef ADEF_ASK_TELL_H
+#define ADEF_ASK_TELL_H
+
+/*
+The C interface of AskTell, for the hosts which are not C++.
+
+    adef_ask_tell* session = adef_ask_tell_create("config.json", 0, 0);
+    while (!adef_ask_tell_is_terminated(session)) {
+        const double* const* variables;
+        size_t size, dimension;
+        adef_ask(session, &variables, &size, &dimension);
+        for (size_t i = 0; i < size; ++i) {
+            fitness[i] = evaluate(variables[i], dimension);
+        }
+        adef_tell(session, fitness);
+    }
+    adef_ask_tell_destroy(session);
+
+The functions return zero on success, or nonzero and keep the message
+for adef_ask_tell_last_error() of the calling thread.
+A session must not be used by several threads at the same time.
+*/
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct adef_ask_tell adef_ask_tell;
+
+/*
+Create the session of the run of the experiment in the configuration
+file. Return NULL on failure.
+*/
+adef_ask_tell* adef_ask_tell_create(const char* config_file,
+                                    size_t experiment,
+                                    unsigned int run);
+/* Destroy the session. */
+void adef_ask_tell_destroy(adef_ask_tell* session);
+
+/*
+Get the individuals to evaluate. The i-th individual has the decision
+variables variables[i][0 .. dimension-1]. The pointers are valid until
+the next adef_tell(). The size is zero after the termination.
+*/
+int adef_ask(adef_ask_tell* session, const double* const** variables,
+             size_t* size, size_t* dimension);
+/* Give the fitness of each individual of the batch. */
+int adef_tell(adef_ask_tell* session, const double* fitness);
+
+/* Return nonzero if the evolution terminates. */
+int adef_ask_tell_is_terminated(const adef_ask_tell* session);
+/* Return the generation of the next batch. */
+unsigned int adef_ask_tell_generation(const adef_ask_tell* session);
+
+/*
+Get the individual of the minimum fitness in the current population.
+The pointer is valid until the next adef_tell().
+*/
+int adef_ask_tell_best(const adef_ask_tell* session, double* fitness,
+                       const double** variables, size_t* dimension);
+
+/* Return the message of the last failure of the calling thread. */
+const char* adef_ask_tell_last_error(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADEF_ASK_TELL_H */
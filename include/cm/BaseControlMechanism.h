@@ -2,7 +2,9 @@
 #define BASE_CONTROL_MECHANISM_H
 
 #include <memory>
+#include <cstddef>
 #include "Prototype.h"
+#include "IndividualContext.h"
 
 namespace adef {
 
@@ -27,13 +29,49 @@ public:
     }
 
 /**
+@brief Initialize this state from other states.
+@param repos The Repository to get initialization informations.
+*/
+    virtual void init(std::shared_ptr<Repository> repos) = 0;
+/**
 @brief Update internal states by the relation between parent and offspring.
+@param repos The Repository which contains the population.
+@param context The context of the target individual.
 */
-    virtual void select(std::shared_ptr<Repository> repos) = 0;
+    virtual void select(std::shared_ptr<Repository> repos,
+                        const IndividualContext& context) = 0;
 /**
 @brief Update the internal states by the current state.
+@param repos The Repository which contains the population.
+@param context The context of the target individual.
+*/
+    virtual void update(std::shared_ptr<Repository> repos,
+                        const IndividualContext& context) = 0;
+/**
+@brief Call select() for each of the first @a size individuals in order.
+@param repos The Repository which contains the population.
+@param size The number of individuals.
+*/
+    virtual void select_all(std::shared_ptr<Repository> repos,
+                            std::size_t size) = 0;
+/**
+@brief Call update() for each of the first @a size individuals in order.
+@param repos The Repository which contains the population.
+@param size The number of individuals.
+*/
+    virtual void update_all(std::shared_ptr<Repository> repos,
+                            std::size_t size) = 0;
+/**
+@brief Return whether update() of an individual reads no objects of
+the other individuals, so update_all() may precede the generations of
+all individuals.
+*/
+    virtual bool has_independent_updates() const { return false; }
+/**
+@brief Return the number of generated objects out of the range.
+@sa ControlRange::number_of_rejections()
 */
-    virtual void update(std::shared_ptr<Repository> repos) = 0;
+    virtual unsigned long long number_of_rejections() const = 0;
 
 private:
 
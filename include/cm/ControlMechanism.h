@@ -3,6 +3,8 @@
 
 #include <cstddef>
 #include <vector>
+#include <typeinfo>
+#include <stdexcept>
 #include "BaseControlMechanism.h"
 #include "cp/ControlParameter.h"
 #include "cf/ControlFunction.h"
@@ -15,6 +17,7 @@
 #include "Parameters.h"
 #include "cf/func/BaseFunction.h"
 #include "cf/func/Function.h"
+#include "cf/func/FunctionProgram.h"
 
 namespace adef {
 
@@ -27,11 +30,11 @@ ControlMechanism defines interfaces to adjust the object:
 - select(): update internal states by the relation between parent and offspring.
 - update(): update internal states by the current state.
 
-@par Requirement
-Take out parameters from Parameters:
-- type @c std::size_t and name "target_index" in
+and their batch versions for the whole population:
+- generate_all(), select_all() and update_all().
+
+The target individual is given by the IndividualContext passed to
 generate(), select() and update().
-.
 For more parameters, see each member classes.
 
 @par The configuration
@@ -156,16 +159,25 @@ its configuration should be
 @brief Initialize this state from other states.
 @param repos The Repository to get initialization informations.
 */
-    void init(std::shared_ptr<Repository> repos)
+    virtual void init(std::shared_ptr<Repository> repos) override
     {
-        function_->init(repos);
+        if (parameter_) { parameter_->init(repos); }
+        if (function_) {
+            function_->init(repos);
+            bind_record_targets(*function_->at(0));
+        }
+        functions_.clear();
+        programs_.clear();
     }
 /**
 @brief Generate the new object by the given mechanism.
+@param repos The Repository which contains the population.
+@param context The context of the target individual.
 */
-    virtual Object generate(std::shared_ptr<Repository> repos)
+    virtual Object generate(std::shared_ptr<Repository> repos,
+                            const IndividualContext& context)
     {
-        auto index = repos->parameters()->take_out<std::size_t>("target_index");
+        auto index = context.target_index;
 
         if (parameter_->is_already_generated(index))
         {
@@ -173,38 +185,185 @@ its configuration should be
         }
         else {
             auto func = std::dynamic_pointer_cast<Function<Object>>(function_->at(index));
-            auto object = func->generate();
-            while (!range_->is_valid(object)) {
-                object = func->generate();
-            }
+            auto object = range_->enforce(func->generate(), *func);
             parameter_->save(object, index);
             return object;
         }
     }
 /**
+@brief Generate the new objects of the first @a size individuals.
+
+It is equivalent to calling generate() for each individual,
+except that the objects are generated in one loop.
+If all Functions have the same type, Function::generate_all() of
+that type is used, and the objects out of range are handled by
+ControlRange::enforce() afterwards.
+@param repos The Repository which contains the population.
+@param size The number of individuals.
+@param objects The generated objects, resized to @a size.
+*/
+    virtual void generate_all(std::shared_ptr<Repository> repos,
+                              std::size_t size,
+                              std::vector<Object>& objects)
+    {
+        bind_functions(size);
+        objects.resize(size);
+
+        std::vector<std::size_t> pending;
+        pending.reserve(size);
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            if (parameter_->is_already_generated(idx)) {
+                objects[idx] = parameter_->load(idx);
+            }
+            else {
+                pending.push_back(idx);
+            }
+        }
+
+        if (size > 0 && pending.size() == size && same_type_functions_) {
+            functions_.front()->generate_all(functions_.data(), size,
+                                             objects.data());
+        }
+        else {
+            for (auto idx : pending) {
+                objects[idx] = functions_[idx]->generate();
+            }
+        }
+        for (auto idx : pending) {
+            objects[idx] = range_->enforce(objects[idx], *functions_[idx]);
+            parameter_->save(objects[idx], idx);
+        }
+    }
+/**
 @brief Update internal states by the relation between parent and offspring.
 */
-    virtual void select(std::shared_ptr<Repository> repos) override
+    virtual void select(std::shared_ptr<Repository> repos,
+                        const IndividualContext& context) override
+    {
+        auto index = context.target_index;
+        selection_->select(repos, context, parameter_, function_->at(index));
+    }
+    virtual void select_all(std::shared_ptr<Repository> repos,
+                            std::size_t size) override
     {
-        auto index = repos->parameters()->take_out<std::size_t>("target_index");
-        selection_->select(repos, parameter_, function_->at(index));
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            select(repos, repos->context(idx));
+        }
     }
 /**
 @brief Update the internal states by the current state.
 */
-    virtual void update(std::shared_ptr<Repository> repos) override
+    virtual void update(std::shared_ptr<Repository> repos,
+                        const IndividualContext& context) override
     {
-        auto index = repos->parameters()->take_out<std::size_t>("target_index");
+        auto index = context.target_index;
         for (auto& update : updates_) {
-            update->update(repos, parameter_, function_->at(index));
+            update->update(repos, context, parameter_, function_->at(index));
         }
 
-        function_->at(index)->update();
+        update_function(index);
         parameter_->reset_already_generated(index);
     }
+/**
+@brief Call update() for each of the first @a size individuals in order.
+
+The update() of the Functions are compiled into FunctionProgram
+once and kept until the next init().
+*/
+    virtual void update_all(std::shared_ptr<Repository> repos,
+                            std::size_t size) override
+    {
+        compile_programs(size);
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            update(repos, repos->context(idx));
+        }
+    }
+/**
+@brief Return @c true if all ControlUpdate are independent.
+@sa ControlUpdate::is_independent()
+*/
+    virtual bool has_independent_updates() const override
+    {
+        for (auto& update : updates_) {
+            if (!update->is_independent()) { return false; }
+        }
+        return true;
+    }
+/**
+@brief Update and generate the objects of the first @a size individuals.
+
+If has_independent_updates(), it calls update_all() and then
+generate_all(). Otherwise update() and generate() alternate for each
+individual in order, so the update of an individual can read the objects
+generated before it in this generation, e.g., SdeFControlMechanism.
+@param repos The Repository which contains the population.
+@param size The number of individuals.
+@param objects The generated objects, resized to @a size.
+*/
+    void update_and_generate_all(std::shared_ptr<Repository> repos,
+                                 std::size_t size,
+                                 std::vector<Object>& objects)
+    {
+        if (has_independent_updates()) {
+            update_all(repos, size);
+            generate_all(repos, size, objects);
+            return;
+        }
+
+        compile_programs(size);
+        objects.resize(size);
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            auto context = repos->context(idx);
+            update(repos, context);
+            objects[idx] = generate(repos, context);
+        }
+    }
+    virtual unsigned long long number_of_rejections() const override
+    {
+        return range_ ? range_->number_of_rejections() : 0;
+    }
 
 protected:
 
+/**
+@brief Call generate() for each of the first @a size individuals in order.
+
+It is the generate_all() of the derived classes which override generate().
+*/
+    void generate_each(std::shared_ptr<Repository> repos,
+                       std::size_t size,
+                       std::vector<Object>& objects)
+    {
+        objects.resize(size);
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            objects[idx] = generate(repos, repos->context(idx));
+        }
+    }
+/**
+@brief Bind the Functions of the first @a size individuals.
+
+The Functions are looked up from ControlFunction once and
+kept until the next init().
+*/
+    void bind_functions(std::size_t size)
+    {
+        if (functions_.size() == size) { return; }
+
+        functions_.resize(size);
+        same_type_functions_ = true;
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            functions_[idx] = dynamic_cast<Function<Object>*>(
+                                            function_->at(idx).get());
+            if (!functions_[idx]) {
+                throw std::logic_error("The Function of ControlMechanism "
+                                       "does not match the type of object");
+            }
+            if (typeid(*functions_[idx]) != typeid(*functions_.front())) {
+                same_type_functions_ = false;
+            }
+        }
+    }
+
 /// The type of pointer to the ControlRange.
     using CRPtr = std::shared_ptr<ControlRange<Object>>;
 /// The range.
@@ -230,6 +389,61 @@ protected:
 /// The function.
     std::vector<CUPtr> updates_;
 
+/**
+@brief Compile the update() of the Functions of the first @a size
+individuals into FunctionProgram.
+
+The individuals sharing the same Function share the same program.
+*/
+    void compile_programs(std::size_t size)
+    {
+        if (!function_ || programs_.size() == size) { return; }
+
+        programs_.clear();
+        programs_.reserve(size);
+        BaseFunction* previous = nullptr;
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            auto function = function_->at(idx).get();
+            if (function != previous) {
+                programs_.push_back(std::make_shared<FunctionProgram>(
+                                        FunctionProgram::compile(*function)));
+                previous = function;
+            }
+            else {
+                programs_.push_back(programs_.back());
+            }
+        }
+    }
+/**
+@brief Update the Function of the individual, by its compiled program if any.
+*/
+    void update_function(std::size_t index)
+    {
+        if (index < programs_.size()) { programs_[index]->run(); }
+        else {
+            function_->at(index)->update();
+        }
+    }
+
+/**
+@brief Resolve the Functions which receive record() of ControlSelection and
+ControlUpdate from @a function, the Function passed to them.
+*/
+    void bind_record_targets(const BaseFunction& function)
+    {
+        if (selection_) { selection_->bind_function(function); }
+        for (auto& update : updates_) {
+            if (update) { update->bind_function(function); }
+        }
+    }
+
+/// The Functions of individuals bound by bind_functions(), owned by function_.
+    std::vector<Function<Object>*> functions_;
+/// The compiled update() of Functions by compile_programs().
+    std::vector<std::shared_ptr<const FunctionProgram>> programs_;
+/// Whether all of functions_ have the same type.
+    bool same_type_functions_ = false;
+
 private:
 
     virtual std::shared_ptr<Prototype> clone_impl() const override
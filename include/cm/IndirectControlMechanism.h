@@ -29,12 +29,9 @@ The difference between this and ControlMechanism:
             it calls select() of contained ControlMechanism.
 - update(): in addition to function,
             it calls update() of contained ControlMechanism.
+- has_independent_updates(): in addition to ControlUpdate,
+            it depends on contained ControlMechanism.
 
-@par Requirement
-Take out parameters from Parameters:
-- type @c std::size_t and name "target_index" in
-generate(), and update().
-.
 
 Now ADEF support many kinds of IndirectControlMechanism:
 - ::IntegerIndirectControlMechanism
@@ -151,43 +148,67 @@ its configuration should be
                                         "ControlMechanism", config, pm);
     }
 
-    Object generate(std::shared_ptr<Repository> repos) override
+    void init(std::shared_ptr<Repository> repos) override
+    {
+        ControlMechanism<T>::init(repos);
+        cm_->init(repos);
+    }
+
+    Object generate(std::shared_ptr<Repository> repos,
+                    const IndividualContext& context) override
     {
-        auto index = repos->parameters()->take_out<std::size_t>("target_index");
+        auto index = context.target_index;
 
         if (parameter_->is_already_generated(index))
         {
             return parameter_->load(index);
         }
         else {
-            auto func = cm_->generate(repos);
-            auto object = func->generate();
-            while (!range_->is_valid(object)) {
-                object = func->generate();
-            }
+            auto func = cm_->generate(repos, context);
+            auto object = range_->enforce(func->generate(), *func);
             parameter_->save(object, index);
             return object;
         }
     }
 
-    void select(std::shared_ptr<Repository> repos) override
+    void generate_all(std::shared_ptr<Repository> repos,
+                      std::size_t size,
+                      std::vector<Object>& objects) override
     {
-        selection_->select(repos, parameter_, cm_->generate(repos));
+        ControlMechanism<T>::generate_each(repos, size, objects);
+    }
 
-        cm_->select(repos);
+    void select(std::shared_ptr<Repository> repos,
+                const IndividualContext& context) override
+    {
+        selection_->select(repos, context, parameter_,
+                           cm_->generate(repos, context));
+
+        cm_->select(repos, context);
     }
 
-    void update(std::shared_ptr<Repository> repos) override
+    void update(std::shared_ptr<Repository> repos,
+                const IndividualContext& context) override
     {
-        auto index = repos->parameters()->take_out<std::size_t>("target_index");
+        auto index = context.target_index;
         for (auto& update : updates_) {
-            update->update(repos, parameter_, cm_->generate(repos));
+            update->update(repos, context, parameter_,
+                           cm_->generate(repos, context));
         }
 
-        cm_->generate(repos)->update();
+        cm_->generate(repos, context)->update();
         parameter_->reset_already_generated(index);
 
-        cm_->update(repos);
+        cm_->update(repos, context);
+    }
+/**
+@brief Return @c true if all ControlUpdate and the contained
+ControlMechanism are independent.
+*/
+    bool has_independent_updates() const override
+    {
+        return ControlMechanism<T>::has_independent_updates() &&
+               cm_->has_independent_updates();
     }
 
 private:
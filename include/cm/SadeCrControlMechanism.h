@@ -2,6 +2,7 @@
 #define SADE_CR_CONTROL_MECHANISM_H
 
 #include <memory>
+#include <cstddef>
 #include "ControlMechanism.h"
 
 namespace adef {
@@ -16,12 +17,6 @@ The difference between this and ControlMechanism:
 - select(): the function to record is inside function "mean".
 - update(): the function to record is inside function "mean".
 
-@par Requirement
-Take out parameters from Parameters:
-- type @c std::size_t and name "target_index" in
-generate(), select(), and update().
-.
-
 @par The configuration
 SadeCrControlMechanism has no extra configurations.@n
 See setup() for the details.
@@ -43,9 +38,23 @@ public:
         return std::dynamic_pointer_cast<SadeCrControlMechanism>(clone_impl());
     }
 
-    void select(std::shared_ptr<Repository> repos) override;
+/**
+@brief Initialize this state from other states.
+
+Resolve the component "mean" of the Function once.
+*/
+    void init(std::shared_ptr<Repository> repos) override;
+
+    void select(std::shared_ptr<Repository> repos,
+                const IndividualContext& context) override;
+
+    void update(std::shared_ptr<Repository> repos,
+                const IndividualContext& context) override;
+
+private:
 
-    void update(std::shared_ptr<Repository> repos) override;
+/// The slot of the component "mean" of the Function.
+    std::size_t mean_slot_ = 0;
 
 private:
 
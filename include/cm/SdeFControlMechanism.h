@@ -22,12 +22,9 @@ the procedure of the F value in the SDE algorithm.
 
 The difference between this and ControlMechanism:
 - generate(): if the object is invalid, then truncate the constant part.
-
-@par Requirement
-Take out parameters from Parameters:
-- type @c std::size_t and name "target_index" in
-generate(), select(), and update().
-.
+- has_independent_updates(): always @c false, since the F of
+  an individual is updated from the F of random individuals,
+  including those generated before it in the same generation.
 
 @par The configuration
 SdeFControlMechanism has no extra configurations.@n
@@ -50,7 +47,16 @@ public:
         return std::dynamic_pointer_cast<SdeFControlMechanism>(clone_impl());
     }
 
-    Object generate(std::shared_ptr<Repository> repos) override;
+    Object generate(std::shared_ptr<Repository> repos,
+                    const IndividualContext& context) override;
+
+    void generate_all(std::shared_ptr<Repository> repos,
+                      std::size_t size,
+                      std::vector<Object>& objects) override
+    {
+        generate_each(repos, size, objects);
+    }
+    bool has_independent_updates() const override { return false; }
 
 private:
 
@@ -58,7 +58,7 @@ If @em Class is derived from ControlFunction, its configuration should be
 @brief Return the function at position @em index.
 @param index The index of function to return.
 */
-    virtual std::shared_ptr<BaseFunction> at(std::size_t index) = 0;
+    virtual const std::shared_ptr<BaseFunction>& at(std::size_t index) = 0;
 
 private:
 
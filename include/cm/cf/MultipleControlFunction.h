@@ -66,7 +66,7 @@ its configuration should be
 
     void init(std::shared_ptr<Repository> repos) override;
 
-    std::shared_ptr<BaseFunction> at(std::size_t index) override;
+    const std::shared_ptr<BaseFunction>& at(std::size_t index) override;
 
 private:
 
@@ -64,7 +64,7 @@ its configuration should be
 
 It ignores @em index because there is only one function.
 */
-    std::shared_ptr<BaseFunction> at(std::size_t index) override
+    const std::shared_ptr<BaseFunction>& at(std::size_t index) override
     {
         return function_;
     }
@@ -2,16 +2,20 @@
 #define BASE_FUNCTION_H
 
 #include <memory>
+#include <cstddef>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <any>
 #include "Prototype.h"
+#include "RecordValue.h"
 
 namespace adef {
 
 class Repository;
 class Individual;
 class Random;
+class FunctionProgram;
 
 /**
 @brief BaseFunction defines interfaces of all Function.
@@ -24,6 +28,8 @@ public:
     using BaseFunctionPtr = std::shared_ptr<BaseFunction>;
 /// The type of the list of BaseFunction::BaseFunctionPtr.
     using BaseFunctionPtrList = std::vector<BaseFunctionPtr>;
+/// The position of no components.
+    static constexpr std::size_t no_slot = static_cast<std::size_t>(-1);
 
     BaseFunction();
     BaseFunction(const BaseFunction& rhs);
@@ -38,7 +44,7 @@ public:
         return std::dynamic_pointer_cast<BaseFunction>(clone_impl());
     }
 /**
-@brief Initialize this state from other states.
+@brief Initialize this state and all child components from other states.
 @param repos The Repository to get initialization informations.
 */
     virtual void init(std::shared_ptr<Repository> repos);
@@ -64,23 +70,87 @@ public:
                         std::shared_ptr<const Individual> offspring,
                         const std::string& name = "") = 0;
 /**
+@brief Record parameter into the given formula without allocations.
+
+It is the typed version of record(). The name is compared without
+constructing a @c std::string and the parameters are not copied.
+@param params Input parameter to be record.
+@param name The name of the child component to be record.
+@return @c true if the record success, otherwise @c false.
+*/
+    virtual bool record(RecordValues params, std::string_view name) = 0;
+/**
+@brief Record parameter into the given formula without allocations.
+@param params Input parameter to be record.
+@param parent The parent individual.
+@param offspring The offspring individual.
+@param name The name of the child component to be record.
+@return @c true if the record success, otherwise @c false.
+*/
+    virtual bool record(RecordValues params,
+                        const std::shared_ptr<const Individual>& parent,
+                        const std::shared_ptr<const Individual>& offspring,
+                        std::string_view name) = 0;
+/**
+@brief Return the position of the component which record() of
+@a name is forwarded to, or BaseFunction::no_slot if this Function
+records it itself.
+
+The default is the position of the component named @a name,
+as Function::record() forwards to it. The derived classes which record
+into themselves for any name return BaseFunction::no_slot.
+@sa RecordTarget
+*/
+    virtual std::size_t record_slot(std::string_view name) const;
+/**
 @brief Update internal states of the given formula.
 
 Update states in order to the next call for generate().
 */
     virtual void update() = 0;
 /**
+@brief Lower update() into the instructions of @a program.
+
+The Function which only updates its components and stores their values
+appends them by FunctionProgram::update() and FunctionProgram::pull().
+@return @c true if lowered, or @c false to call update() as it is,
+        which is the default.
+*/
+    virtual bool lower_update(FunctionProgram& program) { return false; }
+/**
 @brief Return the number of parameters to be recorded.
 */
     virtual unsigned int number_of_parameters() const = 0;
 /**
+@brief Return whether the Function has no mutable states after setup().
+
+Such a Function, e.g., the constant, is shared by the copies of
+its parent composite and by MultipleControlFunction instead of
+being cloned, and it must not change in init().
+The default is @c false.
+*/
+    virtual bool is_shareable() const { return false; }
+/**
+@brief Return the Function itself if it is shareable, otherwise its clone.
+*/
+    static BaseFunctionPtr share_or_clone(const BaseFunctionPtr& function)
+    {
+        if (!function || function->is_shareable()) { return function; }
+        else {
+            return function->clone();
+        }
+    }
+/**
 @brief Set the name of the current Function.
 */
-    void set_function_name(const std::string& name) { name_ = name; }
+    void set_function_name(const std::string& name)
+    {
+        name_ = std::make_shared<const std::string>(name);
+    }
 /**
 @brief Return the name of the current Function.
 */
-    const std::string& function_name() const { return name_; }
+    const std::string& function_name() const { return *name_; }
 /**
 @brief Add a component into the current composite.
 */
@@ -92,14 +162,40 @@ Update states in order to the next call for generate().
 */
     BaseFunctionPtr get_function(const std::string& name) const;
 /**
+@brief Return the component of the current composite by its name.
+
+Unlike get_function(), it neither constructs a @c std::string nor
+copies the pointer.
+@param name The name of the component.
+@return The component to get or @c nullptr if no found.
+*/
+    BaseFunction* find_function(std::string_view name) const;
+/**
+@brief Return the position of the component by its name.
+
+The position of a component does not change after setup(), also in
+the clones, so the derived classes resolve their components once in
+setup() and access them by function_at() without looking up the name.
+@param name The name of the component.
+@exception std::logic_error No component has the name.
+*/
+    std::size_t function_slot(const std::string& name) const;
+/**
+@brief Return the component at the position given by function_slot().
+*/
+    const BaseFunctionPtr& function_at(std::size_t slot) const
+    {
+        return functions_[slot];
+    }
+/**
 @brief Return all components of the current composite.
 */
     BaseFunctionPtrList get_all_functions() const;
 
 protected:
 
-/// The name of the current Function.
-    std::string name_;
+/// The name of the current Function, shared by the clones.
+    std::shared_ptr<const std::string> name_;
 /// The list of contained Function.
     BaseFunctionPtrList functions_;
 
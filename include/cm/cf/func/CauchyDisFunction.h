@@ -2,11 +2,15 @@
 #define CAUCHY_DIS_FUNCTION_H
 
 #include <memory>
+#include <cstddef>
 #include <vector>
 #include <string>
 #include <cstdlib>
 #include <random>
+#include <cmath>
+#include <algorithm>
 #include "Function.h"
+#include "FunctionProgram.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "Random.h"
@@ -22,6 +26,8 @@ CauchyDisFunction has the following feature:
 - generate(): return the random numbers generated by the Cauchy distribution.
 - record(): record parameters into the location and/or scale component.
 - update(): update values of the location and scale.
+- generate_truncated(): return the random number generated by
+  the Cauchy distribution truncated to the interval.
 
 @par Requirement
 record parameters into Function:
@@ -61,7 +67,8 @@ public:
 The default value of location is 0, scale is 1.
 */
     CauchyDisFunction() :
-        location_(0), scale_(1)
+        location_(0), scale_(1),
+        location_slot_(0), scale_slot_(0)
     {
     }
 /**
@@ -71,7 +78,8 @@ The default value of location is 0, scale is 1.
 The default value of location is 0, scale is 1.
 */
     CauchyDisFunction(unsigned int seed) :
-        location_(0), scale_(1)
+        location_(0), scale_(1),
+        location_slot_(0), scale_slot_(0)
     {
     }
 /**
@@ -79,7 +87,8 @@ The default value of location is 0, scale is 1.
 */
     CauchyDisFunction(const CauchyDisFunction& rhs) :
         Function<T>(rhs),
-        location_(rhs.location_), scale_(rhs.scale_)
+        location_(rhs.location_), scale_(rhs.scale_),
+        location_slot_(rhs.location_slot_), scale_slot_(rhs.scale_slot_)
     {
     }
 
@@ -128,6 +137,9 @@ its configuration should be
         scale->set_function_name("scale");
         Function<T>::add_function(scale);
 
+        location_slot_ = Function<T>::bind_function("location");
+        scale_slot_ = Function<T>::bind_function("scale");
+
         location_ = 0;
         scale_ = 1;
     }
@@ -138,15 +150,52 @@ its configuration should be
         return BaseFunction::random_->generate(cauchy);
     }
 
+    void generate_all(Function<T>* const* functions, std::size_t size,
+                      Object* objects) override
+    {
+        using Distribution = std::cauchy_distribution<Object>;
+        Distribution cauchy;
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            auto func = static_cast<CauchyDisFunction*>(functions[idx]);
+            typename Distribution::param_type param(func->location_, func->scale_);
+            objects[idx] = func->random_->generate(cauchy, param);
+        }
+    }
+
+    bool is_truncatable() const override
+    {
+        return true;
+    }
+/**
+@brief Generate the random number by the inverse of the cumulative
+distribution function on the interval.
+
+The angle <tt>atan((x - location) / scale)</tt> of the Cauchy distribution
+is uniform, so it is sampled between the angles of the bounds.
+*/
+    Object generate_truncated(const Object& lower, const Object& upper) override
+    {
+        if (!(scale_ > 0)) { return std::clamp(location_, lower, upper); }
+
+        double low = std::atan((lower - location_) / scale_);
+        double high = std::atan((upper - location_) / scale_);
+        if (!(low < high)) {
+            return std::clamp(location_, lower, upper);
+        }
+        std::uniform_real_distribution<double> uniform(low, high);
+        double z = std::tan(BaseFunction::random_->generate(uniform));
+        return std::clamp<Object>(location_ + scale_ * z, lower, upper);
+    }
+
     void update() override
     {
-        auto location = Function<T>::get_function("location");
-        location->update();
-        location_ = location->generate();
+        update_components(DirectUpdate());
+    }
 
-        auto scale = Function<T>::get_function("scale");
-        scale->update();
-        scale_ = scale->generate();
+    bool lower_update(FunctionProgram& program) override
+    {
+        update_components(program);
+        return true;
     }
 
     unsigned int number_of_parameters() const override
@@ -156,10 +205,22 @@ its configuration should be
 
 private:
 
+/// Update the components by DirectUpdate or FunctionProgram.
+    template<typename Updater>
+    void update_components(Updater&& updater)
+    {
+        updater.pull(*Function<T>::function_at(location_slot_), location_);
+        updater.pull(*Function<T>::function_at(scale_slot_), scale_);
+    }
+
 /// The current value of location.
     Object location_;
 /// The current value of scale.
     Object scale_;
+/// The slot of the component "location".
+    std::size_t location_slot_;
+/// The slot of the component "scale".
+    std::size_t scale_slot_;
 
 private:
 
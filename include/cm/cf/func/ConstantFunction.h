@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <any>
 #include "Function.h"
 #include "cm/ControlledObject.h"
@@ -92,6 +93,23 @@ its configuration should be
         object_ = CO::create(object_config, pm);
     }
 
+/**
+@brief Initialize the object if it is the Function.
+
+The constant number needs no initialization, so it is shareable.
+*/
+    void init(std::shared_ptr<Repository> repos) override
+    {
+        if constexpr (is_shared_ptr<Object>::value) {
+            Function<T>::init(repos);
+        }
+    }
+
+    bool is_shareable() const override
+    {
+        return !is_shared_ptr<Object>::value;
+    }
+
     Object generate() override
     {
         return object_.object;
@@ -111,10 +129,38 @@ its configuration should be
         return record(params, name);
     }
 
+    std::size_t record_slot(std::string_view name) const override
+    {
+        return BaseFunction::no_slot;
+    }
+
+    bool record(RecordValues params, std::string_view name) override
+    {
+        return true;
+    }
+
+    bool record(RecordValues params,
+                const std::shared_ptr<const Individual>& parent,
+                const std::shared_ptr<const Individual>& offspring,
+                std::string_view name) override
+    {
+        return true;
+    }
+
     void update() override
     {
     }
 
+    bool lower_update(FunctionProgram& program) override
+    {
+        return true;
+    }
+
+    const Object* stable_value() const override
+    {
+        return &object_.object;
+    }
+
     unsigned int number_of_parameters() const override
     {
         return 0;
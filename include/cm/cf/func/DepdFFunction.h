@@ -2,6 +2,7 @@
 #define DEPD_F_FUNCTION_H
 
 #include <memory>
+#include <cstddef>
 #include "Function.h"
 
 namespace adef {
@@ -95,16 +96,28 @@ its configuration should be
 
     void update() override;
 
+    bool lower_update(FunctionProgram& program) override;
+
     unsigned int number_of_parameters() const override;
 
 private:
 
+/// Update the components by DirectUpdate or FunctionProgram.
+    template<typename Updater>
+    void update_components(Updater&& updater);
+
 /// The value of the min of fitness.
     Object min_;
 /// The value of the max of fitness.
     Object max_;
 /// The value of the lower bound.
     Object lower_bound_;
+/// The slot of the component "min".
+    std::size_t min_slot_;
+/// The slot of the component "max".
+    std::size_t max_slot_;
+/// The slot of the component "lower_bound".
+    std::size_t lower_bound_slot_;
 
 private:
 
@@ -4,8 +4,11 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <any>
 #include <algorithm>
+#include <cstddef>
+#include <stdexcept>
 #include "BaseFunction.h"
 #include "cm/ControlledObject.h"
 
@@ -97,6 +100,55 @@ its configuration should be
 @brief Generate the new object by given formula.
 */
     virtual Object generate() = 0;
+/**
+@brief Generate the new objects of several Functions in one loop.
+
+All of @a functions must have the same type as this Function, so that
+the derived class can generate them without virtual calls.
+The default calls generate() of each Function in order.
+@param functions The Functions to generate objects.
+@param size The number of Functions.
+@param objects The generated objects, one for each Function.
+*/
+    virtual void generate_all(Function* const* functions, std::size_t size,
+                              Object* objects)
+    {
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            objects[idx] = functions[idx]->generate();
+        }
+    }
+/**
+@brief Return the address of the value that generate() returns if
+generate() has no side effects and update() does nothing, e.g.,
+the constant and the variable, otherwise @c nullptr, which is the default.
+
+FunctionProgram copies the value from the address instead of calling
+generate().
+*/
+    virtual const Object* stable_value() const
+    {
+        return nullptr;
+    }
+/**
+@brief Return whether generate_truncated() is supported.
+*/
+    virtual bool is_truncatable() const
+    {
+        return false;
+    }
+/**
+@brief Generate the new object from the distribution truncated to
+[@a lower, @a upper].
+
+The derived classes which return @c true from is_truncatable() sample it
+directly, e.g., by the inverse of the cumulative distribution function.
+@exception std::logic_error The Function is not truncatable.
+*/
+    virtual Object generate_truncated(const Object& lower, const Object& upper)
+    {
+        throw std::logic_error("The function \"" + function_name() + "\" "
+                               "can not generate the truncated object");
+    }
 
     virtual bool record(const std::vector<std::any>& params,
                         const std::string& name = "") override
@@ -119,6 +171,37 @@ its configuration should be
             return false;
         }
     }
+/**
+@brief Record parameter into the given formula without allocations.
+
+The default records into the child component of the given name.
+If no child component has the name, it falls back to the @c std::any
+overload, so the derived classes which only override that one still
+receive the parameters.
+*/
+    virtual bool record(RecordValues params, std::string_view name) override
+    {
+        auto func = BaseFunction::find_function(name);
+        if (func) { return func->record(params, name); }
+        else {
+            return record(to_any_params(params), std::string(name));
+        }
+    }
+/**
+@copydoc record(RecordValues, std::string_view)
+*/
+    virtual bool record(RecordValues params,
+                        const std::shared_ptr<const Individual>& parent,
+                        const std::shared_ptr<const Individual>& offspring,
+                        std::string_view name) override
+    {
+        auto func = BaseFunction::find_function(name);
+        if (func) { return func->record(params, parent, offspring, name); }
+        else {
+            return record(to_any_params(params), parent, offspring,
+                          std::string(name));
+        }
+    }
 
     virtual void update() override = 0;
 
@@ -148,6 +231,51 @@ its configuration should be
         auto func = BaseFunction::get_function(name);
         return std::dynamic_pointer_cast<Function<Object>>(func);
     }
+/**
+@brief Resolve the component by its name into its position.
+
+It checks once that the component is the Function managing @em U,
+so that function_at() can return it without RTTI.
+@tparam U The type of the object managed by the component.
+@param name The name of the component.
+@exception std::logic_error No component has the name or
+it does not manage @em U.
+*/
+    template<typename U = Object>
+    std::size_t bind_function(const std::string& name) const
+    {
+        auto slot = BaseFunction::function_slot(name);
+        if (!dynamic_cast<Function<U>*>(functions_[slot].get())) {
+            throw std::logic_error("The function \"" + name + "\" "
+                                   "in the \"" + function_name() + "\" "
+                                   "has the wrong type");
+        }
+        return slot;
+    }
+/**
+@brief Return the component at the position given by bind_function().
+@tparam U The type of the object managed by the component.
+*/
+    template<typename U = Object>
+    Function<U>* function_at(std::size_t slot) const
+    {
+        return static_cast<Function<U>*>(functions_[slot].get());
+    }
+
+protected:
+
+/**
+@brief Convert the typed parameters for the @c std::any overload of record().
+*/
+    static std::vector<std::any> to_any_params(RecordValues params)
+    {
+        std::vector<std::any> result;
+        result.reserve(params.size());
+        for (auto&& param : params) {
+            result.push_back(to_any<Object>(param));
+        }
+        return result;
+    }
 
 private:
 
@@ -0,0 +1,193 @@
+#ifndef FUNCTION_PROGRAM_H
+#define FUNCTION_PROGRAM_H
+
+#include <vector>
+#include "BaseFunction.h"
+#include "Function.h"
+
+namespace adef {
+
+/**
+@brief FunctionProgram is the update() of a Function tree lowered into
+a flat list of instructions.
+
+Most composite Functions update in the same way: for each component,
+call its update() and then store its generate() into a member.
+Such a Function lowers its update() by BaseFunction::lower_update()
+into the instructions:
+- update(): the update() of a component that can not be lowered.
+- pull(): store the value of a component into a member. The value of
+  the constant or the variable (see Function::stable_value()) is copied
+  directly, otherwise the virtual generate() is called.
+- update_if(): the instructions of a component which are skipped unless
+  a condition of its parent holds, e.g., LearningPeriodFunction.
+.
+run() executes the instructions in a loop. It calls update() and
+generate() of the remaining Functions in the same order as the tree,
+so the results and the consumption of random numbers are identical.
+
+The instructions keep the pointers to the Functions and their members,
+so the program is valid as long as the tree is not destroyed.
+
+A composite Function lists its components once in a member template which
+takes FunctionProgram in lower_update() and DirectUpdate in update(),
+so that both are the same by construction, e.g.,
+@code
+template<typename Updater>
+void update_components(Updater&& updater)
+{
+    updater.pull(*function_at(mean_slot_), mean_);
+    updater.pull(*function_at(stddev_slot_), stddev_);
+}
+@endcode
+*/
+class FunctionProgram
+{
+public:
+
+/**
+@brief Lower the update() of the Function tree.
+@param root The root of the tree.
+*/
+    static FunctionProgram compile(BaseFunction& root)
+    {
+        FunctionProgram program;
+        program.update(root);
+        return program;
+    }
+/**
+@brief Execute the instructions, which is the same as @a root.update().
+*/
+    void run() const
+    {
+        for (std::size_t idx = 0; idx < instructions_.size(); ++idx) {
+            auto& instruction = instructions_[idx];
+            idx += instruction.execute(instruction);
+        }
+    }
+/**
+@brief Return the number of instructions.
+*/
+    std::size_t size() const { return instructions_.size(); }
+
+/**
+@brief Append the instructions of @a function.update().
+*/
+    void update(BaseFunction& function)
+    {
+        if (!function.lower_update(*this)) {
+            instructions_.push_back({ &execute_update, &function,
+                                      nullptr, nullptr });
+        }
+    }
+/**
+@brief Append the instructions of
+<tt>function.update(); target = function.generate();</tt>.
+*/
+    template<typename U>
+    void pull(Function<U>& function, U& target)
+    {
+        update(function);
+        if (auto source = function.stable_value()) {
+            instructions_.push_back({ &execute_copy<U>, nullptr,
+                                      &target, source });
+        }
+        else {
+            instructions_.push_back({ &execute_generate<U>, &function,
+                                      &target, nullptr });
+        }
+    }
+/**
+@brief Append the instructions of
+<tt>if ((owner.*Condition)()) { function.update(); }</tt>.
+*/
+    template<typename Owner, bool (Owner::*Condition)()>
+    void update_if(Owner& owner, BaseFunction& function)
+    {
+        auto branch = instructions_.size();
+        instructions_.push_back({ &execute_branch<Owner, Condition>, nullptr,
+                                  &owner, nullptr });
+        update(function);
+        instructions_[branch].skip = instructions_.size() - branch - 1;
+    }
+
+private:
+
+/// The instruction.
+    struct Instruction {
+
+        /// The operation, which returns the number of instructions to skip.
+        std::size_t (*execute)(const Instruction&);
+        BaseFunction* function;               ///< The Function to call.
+        void* target;                         ///< The member to store.
+        const void* source;                   ///< The value to copy.
+        std::size_t skip = 0;                 ///< The instructions to skip.
+    };
+
+    static std::size_t execute_update(const Instruction& instruction)
+    {
+        instruction.function->update();
+        return 0;
+    }
+    template<typename U>
+    static std::size_t execute_generate(const Instruction& instruction)
+    {
+        *static_cast<U*>(instruction.target) =
+            static_cast<Function<U>*>(instruction.function)->generate();
+        return 0;
+    }
+    template<typename U>
+    static std::size_t execute_copy(const Instruction& instruction)
+    {
+        *static_cast<U*>(instruction.target) =
+            *static_cast<const U*>(instruction.source);
+        return 0;
+    }
+    template<typename Owner, bool (Owner::*Condition)()>
+    static std::size_t execute_branch(const Instruction& instruction)
+    {
+        auto owner = static_cast<Owner*>(instruction.target);
+        return (owner->*Condition)() ? 0 : instruction.skip;
+    }
+
+/// The instructions.
+    std::vector<Instruction> instructions_;
+};
+
+/**
+@brief DirectUpdate executes the instructions of FunctionProgram
+immediately instead of appending them.
+*/
+class DirectUpdate
+{
+public:
+
+/**
+@brief Execute @a function.update().
+*/
+    void update(BaseFunction& function) const
+    {
+        function.update();
+    }
+/**
+@brief Execute <tt>function.update(); target = function.generate();</tt>.
+*/
+    template<typename U>
+    void pull(Function<U>& function, U& target) const
+    {
+        function.update();
+        target = function.generate();
+    }
+/**
+@brief Execute <tt>if ((owner.*Condition)()) { function.update(); }</tt>.
+*/
+    template<typename Owner, bool (Owner::*Condition)()>
+    void update_if(Owner& owner, BaseFunction& function) const
+    {
+        if ((owner.*Condition)()) { function.update(); }
+    }
+};
+
+}
+
+#endif // FUNCTION_PROGRAM_H
@@ -2,6 +2,7 @@
 #define ISADE_F_FUNCTION_H
 
 #include <memory>
+#include <cstddef>
 #include "Function.h"
 
 namespace adef {
@@ -109,10 +110,16 @@ its configuration should be
 
     void update() override;
 
+    bool lower_update(FunctionProgram& program) override;
+
     unsigned int number_of_parameters() const override;
 
 private:
 
+/// Update the components by DirectUpdate or FunctionProgram.
+    template<typename Updater>
+    void update_components(Updater&& updater);
+
 /// The value of the parameter.
     Object object_;
 /// The value of the min of fitness.
@@ -123,6 +130,16 @@ private:
     Object current_;
 /// The value of the tau.
     Object tau_;
+/// The slot of the component "object".
+    std::size_t object_slot_;
+/// The slot of the component "min".
+    std::size_t min_slot_;
+/// The slot of the component "average".
+    std::size_t average_slot_;
+/// The slot of the component "current".
+    std::size_t current_slot_;
+/// The slot of the component "tau".
+    std::size_t tau_slot_;
 
 private:
 
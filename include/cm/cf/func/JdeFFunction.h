@@ -2,6 +2,7 @@
 #define JDE_F_FUNCTION_H
 
 #include <memory>
+#include <cstddef>
 #include "Function.h"
 
 namespace adef {
@@ -107,12 +108,21 @@ its configuration should be
 
     Object generate() override;
 
+    void generate_all(Function<T>* const* functions, std::size_t size,
+                      Object* objects) override;
+
     void update() override;
 
+    bool lower_update(FunctionProgram& program) override;
+
     unsigned int number_of_parameters() const override;
 
 private:
 
+/// Update the components by DirectUpdate or FunctionProgram.
+    template<typename Updater>
+    void update_components(Updater&& updater);
+
 /// The value of the parameter.
     Object object_;
 /// The value of the lower bound_.
@@ -121,6 +131,14 @@ private:
     Object upper_bound_;
 /// The value of the tau.
     Object tau_;
+/// The slot of the component "object".
+    std::size_t object_slot_;
+/// The slot of the component "lower_bound".
+    std::size_t lower_bound_slot_;
+/// The slot of the component "upper_bound".
+    std::size_t upper_bound_slot_;
+/// The slot of the component "tau".
+    std::size_t tau_slot_;
 
 private:
 
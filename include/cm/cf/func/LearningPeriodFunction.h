@@ -2,9 +2,11 @@
 #define LEARNING_PERIOD_FUNCTION_H
 
 #include <memory>
+#include <cstddef>
 #include <vector>
 #include <string>
 #include "Function.h"
+#include "FunctionProgram.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "Individual.h"
@@ -112,24 +114,27 @@ its configuration should be
         generation->set_function_name("generation");
         Function<T>::add_function(generation);
 
+        object_slot_ = Function<T>::bind_function("object");
+        generation_slot_ = Function<T>::template bind_function<int>(
+                                                            "generation");
+
         learning_period_ = config.get_uint_value("learning_period");
     }
 
     Object generate() override
     {
-        return Function<T>::get_function("object")->generate();
+        return Function<T>::function_at(object_slot_)->generate();
     }
 
     void update() override
     {
-        auto generation = std::dynamic_pointer_cast<Function<int>>(
-                                    BaseFunction::get_function("generation"));
-        generation->update();
-        auto generatio = generation->generate();
+        update_components(DirectUpdate());
+    }
 
-        if (generatio % learning_period_ == 0) {
-            Function<T>::get_function("object")->update();
-        }
+    bool lower_update(FunctionProgram& program) override
+    {
+        update_components(program);
+        return true;
     }
 
     unsigned int number_of_parameters() const override
@@ -139,8 +144,31 @@ its configuration should be
 
 private:
 
+/// Update the components by DirectUpdate or FunctionProgram.
+    template<typename Updater>
+    void update_components(Updater&& updater)
+    {
+        updater.template update_if<LearningPeriodFunction,
+                                   &LearningPeriodFunction::is_period_end>(
+            *this, *Function<T>::function_at(object_slot_));
+    }
+/**
+@brief Update the generation and return whether the learning period ends.
+*/
+    bool is_period_end()
+    {
+        auto generation = Function<T>::template function_at<int>(
+                                                        generation_slot_);
+        generation->update();
+        return generation->generate() % learning_period_ == 0;
+    }
+
 /// The learning period.
     unsigned int learning_period_;
+/// The slot of the component "object".
+    std::size_t object_slot_;
+/// The slot of the component "generation".
+    std::size_t generation_slot_;
 
 private:
 
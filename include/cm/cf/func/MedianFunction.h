@@ -4,18 +4,19 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <any>
-#include <algorithm>
 #include "GatherInfoFunction.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "cm/ControlledObject.h"
 #include "Individual.h"
+#include "util/sliding_quantile.h"
 
 namespace adef {
 
 /**
-@brief MedianFunction generates the median value
+@brief MedianFunction generates the median value, or another quantile,
 from gathering informations.
 @tparam T The type of the object. It must be arithmetic type.
 
@@ -24,6 +25,9 @@ MedianFunction has the following feature:
 - record(): record parameters into the storage.
 - update(): update the median value from storage.
 
+The storage is a SlidingQuantile, so record() costs O(log n) for each
+parameter and update() costs O(1).
+
 ADEF supports many kinds of MedianFunction:
 - IntegerMedianFunction.
 - RealMedianFunction.
@@ -33,6 +37,9 @@ MedianFunction has extra configurations:
 - member
     - name: "initial_value"
     - value: number configuration
+- member (optional)
+    - name: "quantile"
+    - value: number configuration in [0, 1]
 .
 See setup() for the details.
 */
@@ -73,6 +80,13 @@ its configuration should be
 }
 @endcode
 .
+The storage is filled with zeros at first.
+The generated value is the median of the storage by default.
+To generate the 0.75-quantile instead, add
+@code
+    "quantile" : 0.75
+@endcode
+.
 */
     void setup(const Configuration& config, const PrototypeManager& pm) override
     {
@@ -80,8 +94,12 @@ its configuration should be
 
         median_ = config.get_config("initial_value").get_value<Object>();
 
+        auto quantile_config = config.get_config("quantile");
+        auto quantile = quantile_config.is_null() ?
+                        0.5 : quantile_config.get_double_value();
+
         storage_counter_ = 0;
-        storage_.resize(storage_size_);
+        storage_ = SlidingQuantile<Object>(storage_size_, quantile, 0);
     }
 
     Object generate() override
@@ -93,13 +111,7 @@ its configuration should be
                 const std::string& name = "") override
     {
         for (auto&& param : params) {
-
-            storage_.at(storage_counter_) = std::any_cast<Object>(param);
-            storage_counter_++;
-            if (storage_counter_ >= storage_size_) {
-                storage_counter_ = 0;
-                storage_.at(storage_counter_) = 0;
-            }
+            store(std::any_cast<Object>(param));
         }
         return true;
     }
@@ -112,17 +124,31 @@ its configuration should be
         return record(params, name);
     }
 
-    void update() override
+    std::size_t record_slot(std::string_view name) const override
     {
-        auto sorted_storage = storage_;
-        std::sort(sorted_storage.begin(), sorted_storage.end());
+        return BaseFunction::no_slot;
+    }
 
-        auto size = sorted_storage.size();
-        if (size % 2 == 0) {
-            median_ = (sorted_storage[size/2 - 1] + sorted_storage[size/2]) / 2;
+    bool record(RecordValues params, std::string_view name) override
+    {
+        for (auto&& param : params) {
+            store(record_cast<Object>(param));
         }
-        else {
-            median_ = sorted_storage[size/2];
+        return true;
+    }
+
+    bool record(RecordValues params,
+                const std::shared_ptr<const Individual>& parent,
+                const std::shared_ptr<const Individual>& offspring,
+                std::string_view name) override
+    {
+        return record(params, name);
+    }
+
+    void update() override
+    {
+        if (storage_.size() > 0) {
+            median_ = storage_.quantile();
         }
     }
 /**
@@ -143,7 +169,20 @@ private:
 /// The counter of the storage.
     unsigned int storage_counter_;
 /// The storage.
-    std::vector<Object> storage_;
+    SlidingQuantile<Object> storage_;
+
+/**
+@brief Store the value into the storage as a circular buffer.
+*/
+    void store(const Object& value)
+    {
+        storage_.replace(storage_counter_, value);
+        storage_counter_++;
+        if (storage_counter_ >= storage_size_) {
+            storage_counter_ = 0;
+            storage_.replace(storage_counter_, 0);
+        }
+    }
 
 private:
 
@@ -2,15 +2,21 @@
 #define NORMAL_DIS_FUNCTION_H
 
 #include <memory>
+#include <cstddef>
 #include <vector>
 #include <string>
 #include <cstdlib>
 #include <random>
+#include <cmath>
+#include <algorithm>
+#include <utility>
 #include "Function.h"
+#include "FunctionProgram.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "Random.h"
 #include "Individual.h"
+#include "util/math_tool.h"
 
 namespace adef {
 
@@ -22,6 +28,8 @@ NormalDisFunction has the following feature:
 - generate(): return the random number generated by the Normal distribution.
 - record(): record parameters into the mean and/or standard deviation component.
 - update(): update values of the mean and standard deviation.
+- generate_truncated(): return the random number generated by
+  the Normal distribution truncated to the interval.
 
 @par Requirement
 record parameters into Function:
@@ -59,7 +67,8 @@ public:
 The default value of mean is 0, standard deviation is 1.
 */
     NormalDisFunction() :
-        mean_(0), stddev_(1)
+        mean_(0), stddev_(1),
+        mean_slot_(0), stddev_slot_(0)
     {
     }
 /**
@@ -67,7 +76,8 @@ The default value of mean is 0, standard deviation is 1.
 @param seed The seed value of the pseudo-random number generator.
 */
     NormalDisFunction(unsigned int seed) :
-        mean_(0), stddev_(1)
+        mean_(0), stddev_(1),
+        mean_slot_(0), stddev_slot_(0)
     {
     }
 /**
@@ -75,7 +85,8 @@ The default value of mean is 0, standard deviation is 1.
 */
     NormalDisFunction(const NormalDisFunction& rhs) :
         Function<T>(rhs),
-        mean_(rhs.mean_), stddev_(rhs.stddev_)
+        mean_(rhs.mean_), stddev_(rhs.stddev_),
+        mean_slot_(rhs.mean_slot_), stddev_slot_(rhs.stddev_slot_)
     {
     }
 
@@ -124,6 +135,9 @@ its configuration should be
         stddev->set_function_name("stddev");
         Function<T>::add_function(stddev);
 
+        mean_slot_ = Function<T>::bind_function("mean");
+        stddev_slot_ = Function<T>::bind_function("stddev");
+
         mean_ = 0;
         stddev_ = 1;
     }
@@ -134,15 +148,61 @@ its configuration should be
         return BaseFunction::random_->generate(normal);
     }
 
+    void generate_all(Function<T>* const* functions, std::size_t size,
+                      Object* objects) override
+    {
+        using Distribution = std::normal_distribution<Object>;
+        Distribution normal;
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            auto func = static_cast<NormalDisFunction*>(functions[idx]);
+            typename Distribution::param_type param(func->mean_, func->stddev_);
+            objects[idx] = func->random_->generate(normal, param);
+        }
+    }
+
+    bool is_truncatable() const override
+    {
+        return true;
+    }
+/**
+@brief Generate the random number by the inverse of the cumulative
+distribution function on the interval.
+
+The interval above the mean is mirrored below it, where the cumulative
+distribution function keeps its precision in the tail.
+If the interval has no probability in @c double,
+the bound nearest to the mean is returned.
+*/
+    Object generate_truncated(const Object& lower, const Object& upper) override
+    {
+        if (!(stddev_ > 0)) { return std::clamp(mean_, lower, upper); }
+
+        double low = (lower - mean_) / stddev_;
+        double high = (upper - mean_) / stddev_;
+        bool mirrored = low > 0;
+        if (mirrored) { low = -low; high = -high; std::swap(low, high); }
+
+        double low_cdf = normal_cdf(low);
+        double high_cdf = normal_cdf(high);
+        if (!(low_cdf < high_cdf)) {
+            return std::clamp(mean_, lower, upper);
+        }
+        std::uniform_real_distribution<double> uniform(low_cdf, high_cdf);
+        double z = normal_quantile(BaseFunction::random_->generate(uniform));
+        z = std::clamp(z, low, high);
+        if (mirrored) { z = -z; }
+        return std::clamp<Object>(mean_ + stddev_ * z, lower, upper);
+    }
+
     void update() override
     {
-        auto mean = Function<T>::get_function("mean");
-        mean->update();
-        mean_ = mean->generate();
+        update_components(DirectUpdate());
+    }
 
-        auto stddev = Function<T>::get_function("stddev");
-        stddev->update();
-        stddev_ = stddev->generate();
+    bool lower_update(FunctionProgram& program) override
+    {
+        update_components(program);
+        return true;
     }
 
     unsigned int number_of_parameters() const override
@@ -152,10 +212,22 @@ its configuration should be
 
 private:
 
+/// Update the components by DirectUpdate or FunctionProgram.
+    template<typename Updater>
+    void update_components(Updater&& updater)
+    {
+        updater.pull(*Function<T>::function_at(mean_slot_), mean_);
+        updater.pull(*Function<T>::function_at(stddev_slot_), stddev_);
+    }
+
 /// The value of mean.
     Object mean_;
 /// The value of standard deviation.
     Object stddev_;
+/// The slot of the component "mean".
+    std::size_t mean_slot_;
+/// The slot of the component "stddev".
+    std::size_t stddev_slot_;
 
 private:
 
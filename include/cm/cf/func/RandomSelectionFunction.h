@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <any>
 #include <cstdlib>
 #include <random>
@@ -140,9 +141,19 @@ its configuration should be
         }
     }
 
+    void init(std::shared_ptr<Repository> repos) override
+    {
+        Function<T>::init(repos);
+        if constexpr (is_shared_ptr<Object>::value) {
+            for (auto& object : objects_) {
+                object.object->init(repos);
+            }
+        }
+    }
+
     Object generate() override
     {
-        static std::uniform_int_distribution<unsigned int>
+        std::uniform_int_distribution<unsigned int>
             uniform(0, objects_.size() -1);
         auto index = BaseFunction::random_->generate(uniform);
 
@@ -163,6 +174,24 @@ its configuration should be
         return true;
     }
 
+    std::size_t record_slot(std::string_view name) const override
+    {
+        return BaseFunction::no_slot;
+    }
+
+    bool record(RecordValues params, std::string_view name) override
+    {
+        return true;
+    }
+
+    bool record(RecordValues params,
+                const std::shared_ptr<const Individual>& parent,
+                const std::shared_ptr<const Individual>& offspring,
+                std::string_view name) override
+    {
+        return true;
+    }
+
     void update() override
     {
     }
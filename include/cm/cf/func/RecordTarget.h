@@ -0,0 +1,77 @@
+#ifndef RECORD_TARGET_H
+#define RECORD_TARGET_H
+
+#include <cstddef>
+#include <vector>
+#include <string>
+#include <utility>
+#include "BaseFunction.h"
+
+namespace adef {
+
+/**
+@brief RecordTarget is the Function which receives record() of a name,
+resolved once into the positions of components.
+
+Function::record() forwards to the component of the name at each level,
+which compares the names of all components.
+RecordTarget follows these forwards once in bind() by
+BaseFunction::record_slot(), so that resolve() returns the receiver by
+the positions only.@n
+The positions of components are the same in the clones,
+see BaseFunction::function_slot(), so the target bound to the Function of
+an individual is also valid for those of the other individuals.
+
+Before bind(), resolve() returns the given Function itself, on which
+record() looks up the name as usual.
+*/
+class RecordTarget
+{
+public:
+
+    explicit RecordTarget(std::string name) : name_(std::move(name))
+    {
+    }
+
+/**
+@brief Return the name to be recorded.
+*/
+    const std::string& name() const { return name_; }
+/**
+@brief Resolve the receiver of record() from @a function.
+*/
+    void bind(const BaseFunction& function)
+    {
+        slots_.clear();
+        auto func = &function;
+        for (auto slot = func->record_slot(name_);
+             slot != BaseFunction::no_slot;
+             slot = func->record_slot(name_)) {
+
+            slots_.push_back(slot);
+            func = func->function_at(slot).get();
+        }
+    }
+/**
+@brief Return the receiver of record() in @a function.
+@param function The Function which has the same components as
+the one given to bind().
+*/
+    BaseFunction& resolve(BaseFunction& function) const
+    {
+        auto func = &function;
+        for (auto slot : slots_) {
+            func = func->function_at(slot).get();
+        }
+        return *func;
+    }
+
+private:
+
+    std::string name_;
+    std::vector<std::size_t> slots_;
+};
+
+}
+
+#endif // RECORD_TARGET_H
@@ -0,0 +1,165 @@
+#ifndef RECORD_VALUE_H
+#define RECORD_VALUE_H
+
+#include <memory>
+#include <cstddef>
+#include <array>
+#include <vector>
+#include <variant>
+#include <any>
+#include <type_traits>
+#include "cm/ControlledObject.h"
+
+namespace adef {
+
+class BaseFunction;
+
+/**
+@brief RecordValue is one parameter passed to the typed Function::record().
+
+It holds the objects which are controlled by ControlMechanism:
+- @c double for ::RealFunction.
+- @c int for ::IntegerFunction.
+- the pointer to BaseFunction for ::RealControlFunction and
+  ::IntegerControlFunction.
+.
+Unlike @c std::any, it never allocates memory.
+*/
+using RecordValue = std::variant<double, int, std::shared_ptr<BaseFunction>>;
+
+/**
+@brief RecordValues is the read-only view of consecutive RecordValue.
+
+It does not own the values, so the caller keeps them alive during
+the call of Function::record(), e.g., in an array on the stack:
+@code
+RecordValue values[] = { fitness };
+function->record(RecordValues(values), "current");
+@endcode
+*/
+class RecordValues
+{
+public:
+
+    RecordValues() = default;
+    RecordValues(const RecordValue* data, std::size_t size) :
+        data_(data), size_(size)
+    {
+    }
+    template<std::size_t N>
+    RecordValues(const RecordValue (&values)[N]) :
+        data_(values), size_(N)
+    {
+    }
+
+    const RecordValue* begin() const { return data_; }
+    const RecordValue* end() const { return data_ + size_; }
+    const RecordValue& operator[](std::size_t idx) const { return data_[idx]; }
+    const RecordValue& front() const { return data_[0]; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+
+    const RecordValue* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+@brief RecordBuffer stores RecordValue for the call of Function::record()
+whose number of parameters is known only at run time.
+@tparam N The number of values stored without allocations.
+
+The values beyond @a N are moved to the heap, so it never fails.
+*/
+template<std::size_t N>
+class RecordBuffer
+{
+public:
+
+/**
+@brief Append the value.
+*/
+    void push_back(RecordValue value)
+    {
+        if (size_ < N) {
+            values_[size_] = std::move(value);
+        }
+        else {
+            if (overflow_.empty()) {
+                overflow_.assign(values_.begin(), values_.end());
+            }
+            overflow_.push_back(std::move(value));
+        }
+        ++size_;
+    }
+/**
+@brief Return the view of the stored values.
+*/
+    RecordValues values() const
+    {
+        if (size_ <= N) { return RecordValues(values_.data(), size_); }
+        else {
+            return RecordValues(overflow_.data(), size_);
+        }
+    }
+
+private:
+
+    std::array<RecordValue, N> values_;
+    std::vector<RecordValue> overflow_;
+    std::size_t size_ = 0;
+};
+
+/**
+@brief Return the RecordValue which holds the object.
+@tparam T The type of the object.
+*/
+template<typename T>
+RecordValue to_record_value(const T& object)
+{
+    if constexpr (is_shared_ptr<T>::value) {
+        return std::shared_ptr<BaseFunction>(object);
+    }
+    else {
+        return object;
+    }
+}
+
+/**
+@brief Return the object held by the RecordValue.
+@tparam T The type of the object.
+@exception std::bad_variant_access The RecordValue does not hold @a T.
+*/
+template<typename T>
+T record_cast(const RecordValue& value)
+{
+    if constexpr (is_shared_ptr<T>::value) {
+        return std::static_pointer_cast<typename T::element_type>(
+                    std::get<std::shared_ptr<BaseFunction>>(value));
+    }
+    else {
+        return std::get<T>(value);
+    }
+}
+
+/**
+@brief Return the @c std::any which holds the same object as the RecordValue.
+
+It is used to fall back to the @c std::any overload of Function::record().
+@tparam T The type of the object of the Function which receives the value.
+*/
+template<typename T>
+std::any to_any(const RecordValue& value)
+{
+    if constexpr (is_shared_ptr<T>::value) {
+        if (std::holds_alternative<std::shared_ptr<BaseFunction>>(value)) {
+            return std::any(record_cast<T>(value));
+        }
+    }
+    return std::visit([](auto&& object) { return std::any(object); }, value);
+}
+
+}
+
+#endif // RECORD_VALUE_H
@@ -4,9 +4,8 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <random>
-#include <list>
-#include <cmath>
 #include <limits>
 #include <stdexcept>
 #include <any>
@@ -16,6 +15,7 @@
 #include "PrototypeManager.h"
 #include "Random.h"
 #include "Individual.h"
+#include "util/alias_table.h"
 
 namespace adef {
 
@@ -29,6 +29,10 @@ RouletteWheelSelectionFunction has the following feature:
 - record(): change scores.
 - update(): update scores.
 
+Each object keeps its last @em score_size scores in a ring buffer with
+their running sum, and its weight is the average of them.
+update() rebuilds an AliasTable of the weights, so generate() is O(1).
+
 ADEF supports many kinds of RouletteWheelSelectionFunction:
 - ::IntegerRouletteWheelSelectionFunction.
 - ::RealRouletteWheelSelectionFunction.
@@ -82,7 +86,10 @@ The default value of the maximum of score size is 0.
     RouletteWheelSelectionFunction(const RouletteWheelSelectionFunction& rhs) :
         ScoredFunction<T>(rhs),
         score_size_(rhs.score_size_),
-        valued_objects_(rhs.valued_objects_)
+        valued_objects_(rhs.valued_objects_),
+        weights_(rhs.weights_),
+        table_(rhs.table_),
+        table_changed_(rhs.table_changed_)
     {
     }
 
@@ -164,49 +171,37 @@ its configuration should be
 
             ValuedObject v;
             v.score_counter_ = 0;
-            v.score_ = 0;
+            v.score_number_ = 0;
+            v.score_sum_ = 0;
+            v.scores_.assign(score_size_, 0);
             v.object_ = object;
             valued_objects_.push_back(v);
         }
+        if (valued_objects_.empty()) {
+            throw std::logic_error("RouletteWheelSelectionFunction has no objects.");
+        }
+        weights_.resize(valued_objects_.size());
+        table_changed_ = true;
+        build_table();
     }
 
-    Object generate() override
+    void init(std::shared_ptr<Repository> repos) override
     {
-        Score sum_score = 0;
-        for (auto& valued_object : valued_objects_) {
-
-            if (valued_object.score_ < std::numeric_limits<Score>::epsilon()) {
-                valued_object.score_ = std::numeric_limits<Score>::epsilon();
-            }
-            sum_score += valued_object.score_;
-        }
-
-        // if sum of score is zero, randomly select
-        if (std::abs(sum_score) < std::numeric_limits<Score>::epsilon()) {
-
-            std::uniform_int_distribution<> uniform(0, valued_objects_.size() -1);
-            unsigned int index = BaseFunction::random_->generate(uniform);
-            return valued_objects_.at(index).object_.object;
-        }
-        else {
-
-            std::uniform_real_distribution<Score> uniform(0, sum_score);
-            Score rnd = BaseFunction::random_->generate(uniform);
-
-            Score cumulative_weight = 0;
+        ScoredFunction<T>::init(repos);
+        if constexpr (is_shared_ptr<Object>::value) {
             for (auto& valued_object : valued_objects_) {
-
-                cumulative_weight += valued_object.score_;
-                if (rnd < cumulative_weight ||
-                    std::abs(rnd-cumulative_weight) < std::numeric_limits<Score>::epsilon()) {
-
-                    return valued_object.object_.object;
-                }
+                valued_object.object_.object->init(repos);
             }
-            throw std::logic_error("RouletteWheelSelectionFunction generate error.");
         }
     }
 
+    Object generate() override
+    {
+        std::uniform_real_distribution<double> uniform(0, table_.size());
+        auto index = table_.sample(BaseFunction::random_->generate(uniform));
+        return valued_objects_[index].object_.object;
+    }
+
     bool record(const std::vector<std::any>& params,
                 const std::string& name = "") override
     {
@@ -219,39 +214,33 @@ its configuration should be
                 const std::string& name = "") override
     {
         // only one param
-        auto param = std::any_cast<Object>(params.front());
-        auto result = std::find_if(valued_objects_.begin(),
-                                   valued_objects_.end(),
-                                   [&param](const ValuedObject& object) {
-                                       return object.object_.object == param;
-                                   });
-        if (result == valued_objects_.end()) {
-            throw std::logic_error("RouletteWheelSelectionFunction accept wrong record parameter.");
-        }
+        add_score(std::any_cast<Object>(params.front()), parent, offspring);
+        return true;
+    }
 
-        result->scores_.push_back(scoring_function_->calculate_score(parent, offspring));
+    std::size_t record_slot(std::string_view name) const override
+    {
+        return BaseFunction::no_slot;
+    }
 
-        if (result->scores_.size() >= score_size_) {
-            result->scores_.pop_front();
-        }
+    bool record(RecordValues params, std::string_view name) override
+    {
         return true;
     }
 
-    void update() override
+    bool record(RecordValues params,
+                const std::shared_ptr<const Individual>& parent,
+                const std::shared_ptr<const Individual>& offspring,
+                std::string_view name) override
     {
-        for (auto& valued_object : valued_objects_) {
+        // only one param
+        add_score(record_cast<Object>(params.front()), parent, offspring);
+        return true;
+    }
 
-            // update score from score_memory
-            valued_object.score_ = 0;
-            for (auto& score : valued_object.scores_) {
-                valued_object.score_ += score;
-            }
-            if (valued_object.scores_.size() > 0) {
-                valued_object.score_ /= valued_object.scores_.size();
-            }
-            // clear
-            valued_object.scores_.clear();
-        }
+    void update() override
+    {
+        build_table();
     }
 
     unsigned int number_of_parameters() const override
@@ -268,25 +257,89 @@ private:
     using CO = ControlledObject<Object>;
 /**
 @brief ValuedObject contains informations of the object including
-its score, and scores.
+its scores.
 */
     struct ValuedObject {
 
-/// The counter of the score.
+/// The position in the ring buffer of the next score.
         unsigned int score_counter_;
-/// The list of scores of the object.
-        std::list<Score> scores_;
-/// The score of the object.
-        Score score_;
+/// The number of scores in the ring buffer.
+        unsigned int score_number_;
+/// The sum of scores in the ring buffer.
+        Score score_sum_;
+/// The ring buffer of the last scores of the object.
+        std::vector<Score> scores_;
 /// The object.
         CO object_;
     };
 /// The list of valued objects.
     std::vector<ValuedObject> valued_objects_;
+/// The weights of objects for the table.
+    std::vector<Score> weights_;
+/// The table to select the object.
+    AliasTable table_;
+/// Whether the scores changed since the table was built.
+    bool table_changed_ = false;
 
 /// @copydoc ScoredFunction::scoring_function_
     using ScoredFunction<T>::scoring_function_;
 
+/**
+@brief Append the score of the offspring to the object.
+@exception std::logic_error The object is not in the list.
+*/
+    void add_score(const Object& param,
+               const std::shared_ptr<const Individual>& parent,
+               const std::shared_ptr<const Individual>& offspring)
+    {
+        auto result = std::find_if(valued_objects_.begin(),
+                                   valued_objects_.end(),
+                                   [&param](const ValuedObject& object) {
+                                       return object.object_.object == param;
+                                   });
+        if (result == valued_objects_.end()) {
+            throw std::logic_error("RouletteWheelSelectionFunction accept wrong record parameter.");
+        }
+        if (score_size_ == 0) { return; }
+
+        auto score = scoring_function_->calculate_score(parent, offspring);
+        auto& old_score = result->scores_[result->score_counter_];
+        if (result->score_number_ < score_size_) { result->score_number_++; }
+        else { result->score_sum_ -= old_score; }
+        old_score = score;
+        result->score_sum_ += score;
+
+        result->score_counter_++;
+        if (result->score_counter_ >= score_size_) {
+            result->score_counter_ = 0;
+            // the running sum is renewed once per round against the rounding error
+            result->score_sum_ = 0;
+            for (auto&& value : result->scores_) { result->score_sum_ += value; }
+        }
+        table_changed_ = true;
+    }
+/**
+@brief Build the table from the average scores if they changed.
+
+The average score less than epsilon is taken as epsilon so that
+every object can be selected.
+*/
+    void build_table()
+    {
+        if (!table_changed_) { return; }
+
+        for (std::size_t idx = 0; idx < valued_objects_.size(); ++idx) {
+            auto& valued_object = valued_objects_[idx];
+            Score score = 0;
+            if (valued_object.score_number_ > 0) {
+                score = valued_object.score_sum_ / valued_object.score_number_;
+            }
+            weights_[idx] = std::max(score, std::numeric_limits<Score>::epsilon());
+        }
+        table_.build(weights_);
+        table_changed_ = false;
+    }
+
 private:
 
     std::shared_ptr<Prototype> clone_impl() const override
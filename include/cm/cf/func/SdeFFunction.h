@@ -2,8 +2,10 @@
 #define SDE_F_FUNCTION_H
 
 #include <memory>
+#include <cstddef>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <any>
 #include "Function.h"
 
@@ -102,14 +104,34 @@ its configuration should be
                 std::shared_ptr<const Individual> offspring,
                 const std::string& name = "") override;
 
+    std::size_t record_slot(std::string_view name) const override
+    {
+        return BaseFunction::no_slot;
+    }
+
+    bool record(RecordValues params, std::string_view name) override;
+
+    bool record(RecordValues params,
+                const std::shared_ptr<const Individual>& parent,
+                const std::shared_ptr<const Individual>& offspring,
+                std::string_view name) override;
+
     void update() override;
 
+    bool lower_update(FunctionProgram& program) override;
+
     unsigned int number_of_parameters() const override;
 
 private:
 
+/// Update the components by DirectUpdate or FunctionProgram.
+    template<typename Updater>
+    void update_components(Updater&& updater);
+
 /// The list of parameters
     std::vector<Object> parameters_;
+/// The slot of the component "rand".
+    std::size_t rand_slot_;
 
 private:
 
@@ -2,10 +2,13 @@
 #define UNIFORM_DIS_FUNCTION_H
 
 #include <memory>
+#include <cstddef>
 #include <vector>
 #include <string>
 #include <random>
+#include <algorithm>
 #include "Function.h"
+#include "FunctionProgram.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "Random.h"
@@ -23,6 +26,8 @@ UniformDisFunction has the following feature:
 according to the uniform distribution.
 - record(): record parameters into the lower bound and/or upper bound component.
 - update(): update values of the lower bound and upper bound.
+- generate_truncated(): return the random number generated by
+  the Uniform distribution truncated to the interval.
 
 @par Requirement
 record parameters into Function:
@@ -63,7 +68,8 @@ public:
 The default value of the lower bound is 0, upper bound is 1.
 */
     UniformDisFunction() :
-        lower_bound_(0), upper_bound_(1)
+        lower_bound_(0), upper_bound_(1),
+        lower_bound_slot_(0), upper_bound_slot_(0)
     {
     }
 /**
@@ -71,7 +77,8 @@ The default value of the lower bound is 0, upper bound is 1.
 @param seed The seed value of the pseudo-random number generator.
 */
     UniformDisFunction(unsigned int seed) :
-        lower_bound_(0), upper_bound_(1)
+        lower_bound_(0), upper_bound_(1),
+        lower_bound_slot_(0), upper_bound_slot_(0)
     {
     }
 /**
@@ -79,7 +86,8 @@ The default value of the lower bound is 0, upper bound is 1.
 */
     UniformDisFunction(const UniformDisFunction& rhs) :
         Function<T>(rhs),
-        lower_bound_(rhs.lower_bound_), upper_bound_(rhs.upper_bound_)
+        lower_bound_(rhs.lower_bound_), upper_bound_(rhs.upper_bound_),
+        lower_bound_slot_(rhs.lower_bound_slot_), upper_bound_slot_(rhs.upper_bound_slot_)
     {
     }
 
@@ -128,24 +136,47 @@ its configuration should be
         upper_bound->set_function_name("upper_bound");
         Function<T>::add_function(upper_bound);
 
+        lower_bound_slot_ = Function<T>::bind_function("lower_bound");
+        upper_bound_slot_ = Function<T>::bind_function("upper_bound");
+
         lower_bound_ = 0;
         upper_bound_ = 1;
     }
 
     Object generate() override
     {
-        return generate_impl<>();
+        return generate_impl<>(lower_bound_, upper_bound_);
+    }
+
+    bool is_truncatable() const override
+    {
+        return true;
+    }
+/**
+@brief Generate the random number uniformly on the intersection of
+the interval and the bounds.
+
+If they do not intersect, the bound nearest to the distribution is returned.
+*/
+    Object generate_truncated(const Object& lower, const Object& upper) override
+    {
+        auto low = std::max(lower_bound_, lower);
+        auto high = std::min(upper_bound_, upper);
+        if (high < low) {
+            return upper_bound_ < lower ? lower : upper;
+        }
+        return generate_impl<>(low, high);
     }
 
     void update() override
     {
-        auto lower_bound = Function<T>::get_function("lower_bound");
-        lower_bound->update();
-        lower_bound_ = lower_bound->generate();
+        update_components(DirectUpdate());
+    }
 
-        auto upper_bound = Function<T>::get_function("upper_bound");
-        upper_bound->update();
-        upper_bound_ = upper_bound->generate();
+    bool lower_update(FunctionProgram& program) override
+    {
+        update_components(program);
+        return true;
     }
 
     unsigned int number_of_parameters() const override
@@ -155,26 +186,38 @@ its configuration should be
 
 private:
 
+/// Update the components by DirectUpdate or FunctionProgram.
+    template<typename Updater>
+    void update_components(Updater&& updater)
+    {
+        updater.pull(*Function<T>::function_at(lower_bound_slot_), lower_bound_);
+        updater.pull(*Function<T>::function_at(upper_bound_slot_), upper_bound_);
+    }
+
 /// The value of the lower bound.
     Object lower_bound_;
 /// The value of the upper bound.
     Object upper_bound_;
+/// The slot of the component "lower_bound".
+    std::size_t lower_bound_slot_;
+/// The slot of the component "upper_bound".
+    std::size_t upper_bound_slot_;
 
 private:
 
     template<typename U = Object>
-    U generate_impl(
+    U generate_impl(U lower_bound, U upper_bound,
         std::enable_if_t<std::is_integral<U>::value>* = nullptr)
     {
-        std::uniform_int_distribution<> uniform(lower_bound_, upper_bound_);
+        std::uniform_int_distribution<> uniform(lower_bound, upper_bound);
         return BaseFunction::random_->generate(uniform);
     }
 
     template<typename U = Object>
-    U generate_impl(
+    U generate_impl(U lower_bound, U upper_bound,
         std::enable_if_t<std::is_floating_point<U>::value>* = nullptr)
     {
-        std::uniform_real_distribution<> uniform(lower_bound_, upper_bound_);
+        std::uniform_real_distribution<> uniform(lower_bound, upper_bound);
         return BaseFunction::random_->generate(uniform);
     }
 
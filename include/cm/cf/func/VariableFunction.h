@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <any>
 #include "Function.h"
 #include "cm/ControlledObject.h"
@@ -130,10 +131,39 @@ its configuration should be
         return record(params, name);
     }
 
+    std::size_t record_slot(std::string_view name) const override
+    {
+        return BaseFunction::no_slot;
+    }
+
+    bool record(RecordValues params, std::string_view name) override
+    {
+        object_.object = record_cast<Object>(params.front());
+        return true;
+    }
+
+    bool record(RecordValues params,
+                const std::shared_ptr<const Individual>& parent,
+                const std::shared_ptr<const Individual>& offspring,
+                std::string_view name) override
+    {
+        return record(params, name);
+    }
+
     void update() override
     {
     }
 
+    bool lower_update(FunctionProgram& program) override
+    {
+        return true;
+    }
+
+    const Object* stable_value() const override
+    {
+        return &object_.object;
+    }
+
     unsigned int number_of_parameters() const override
     {
         return 1;
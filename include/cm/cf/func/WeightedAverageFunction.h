@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <any>
 #include "ScoredFunction.h"
 
@@ -88,6 +89,18 @@ its configuration should be
                 std::shared_ptr<const Individual> offspring,
                 const std::string& name = "") override;
 
+    std::size_t record_slot(std::string_view name) const override
+    {
+        return BaseFunction::no_slot;
+    }
+
+    bool record(RecordValues params, std::string_view name) override;
+
+    bool record(RecordValues params,
+                const std::shared_ptr<const Individual>& parent,
+                const std::shared_ptr<const Individual>& offspring,
+                std::string_view name) override;
+
     void update() override;
 
     unsigned int number_of_parameters() const override;
@@ -108,6 +121,13 @@ private:
         Score score_;  ///< The score of the object.
         CO object_;    ///< The object.
     };
+
+/**
+@brief Store the object and its score into the memory.
+*/
+    void store(const Object& object,
+               const std::shared_ptr<const Individual>& parent,
+               const std::shared_ptr<const Individual>& offspring);
 /// The counter of the valued object.
     unsigned int valued_object_counter_;
 /// The list of valued objects.
@@ -110,19 +110,32 @@ its configuration should be
         if (init_config.is_number()) {
             objects_.assign(size, init_config.get_value<Object>());
         }
-        // initial value is generated from Function
+        // initial value is generated from Function in init()
         else if (init_config.is_object()) {
-            auto func = make_and_setup_type<Function<Object>>(init_config, pm);
-            for (auto& object : objects_) {
-                func->update();
-                object = func->generate();
-            }
+            initial_function_ =
+                make_and_setup_type<Function<Object>>(init_config, pm);
         }
         // initial value is default value of Object type
         else {
         }
     }
 /**
+@brief Initialize this state from other states.
+
+Generate the initial values if they are given by Function,
+which needs the random generator of @a repos.
+*/
+    void init(std::shared_ptr<Repository> repos) override
+    {
+        if (!initial_function_) { return; }
+        auto func = initial_function_->clone();
+        func->init(repos);
+        for (auto& object : objects_) {
+            func->update();
+            object = func->generate();
+        }
+    }
+/**
 @name object access
 */
 ///@{
@@ -164,6 +177,8 @@ private:
     std::vector<Object> objects_;
 /// The flag of already generated
     std::vector<bool> already_generated_;
+/// The Function to generate the initial values.
+    std::shared_ptr<Function<Object>> initial_function_;
 
 private:
 
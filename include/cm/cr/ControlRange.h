@@ -2,6 +2,9 @@
 #define CONTROL_RANGE_H
 
 #include <memory>
+#include <string>
+#include <cmath>
+#include <stdexcept>
 #include <type_traits>
 #include "Prototype.h"
 #include "cm/ControlledObject.h"
@@ -18,6 +21,18 @@ namespace adef {
 
 ControlRange defines the following interfaces:
 - is_valid(): check whether the object is in the range.
+- enforce(): bring the generated object into the range by the policy.
+
+The policy handles the object out of the range:
+- "retry": generate the object again, at most @em max_retries times,
+  and then clip the last one. It is the default.
+- "truncate": generate the object from the distribution truncated to
+  the range if the Function supports it (see Function::is_truncatable()),
+  otherwise retry.
+- "clip": move the object to the nearest bound.
+- "reflect": reflect the object at the bounds into the range.
+.
+number_of_rejections() counts the generated objects out of the range.
 
 Now ADEF support many kinds of ControlRange:
 - ::IntegerControlRange
@@ -37,6 +52,12 @@ ControlRange has extra configurations:
 - member
     - name: "upper_bound"
     - value: @c double
+- member (optional)
+    - name: "policy"
+    - value: "retry", "truncate", "clip" or "reflect"
+- member (optional)
+    - name: "max_retries"
+    - value: <tt>unsigned int</tt>, default 1000
 .
 See setup() for the details.
 */
@@ -48,6 +69,9 @@ public:
 /// The type of the object.
     using Object = typename ControlledObject<T>::Object;
 
+/// The way to handle the object out of the range.
+    enum class Policy { retry, truncate, clip, reflect };
+
     ControlRange() = default;
     ControlRange(Object lower_bound, Object upper_bound) :
         lower_bound_(lower_bound), upper_bound_(upper_bound)
@@ -80,6 +104,11 @@ its configuration should be
 }
 @endcode
 .
+To sample the truncated distribution instead of retrying, add
+@code
+    "policy" : "truncate"
+@endcode
+.
 */
     void setup(const Configuration& config, const PrototypeManager& pm) override
     {
@@ -87,6 +116,19 @@ its configuration should be
         lower_bound_ = lower_bound_config.get_value<Object>();
         auto upper_bound_config = config.get_config("upper_bound");
         upper_bound_ = upper_bound_config.get_value<Object>();
+
+        auto policy_config = config.get_config("policy");
+        if (!policy_config.is_null()) {
+            auto policy = policy_config.get_string_value();
+            if (policy == "retry") { policy_ = Policy::retry; }
+            else if (policy == "truncate") { policy_ = Policy::truncate; }
+            else if (policy == "clip") { policy_ = Policy::clip; }
+            else if (policy == "reflect") { policy_ = Policy::reflect; }
+            else { throw std::domain_error("The policy of ControlRange error."); }
+        }
+        auto max_retries_config = config.get_config("max_retries");
+        max_retries_ = max_retries_config.is_null() ?
+                            1000 : max_retries_config.get_uint_value();
     }
 /**
 @name Setting
@@ -118,13 +160,78 @@ its configuration should be
                    object <= upper_bound_;
         }
     }
+/**
+@brief Return the object if it is in the range, otherwise
+bring it into the range by the policy.
+@param object The object generated by @a function.
+@param function The Function which generated the object.
+*/
+    Object enforce(Object object, Function<Object>& function)
+    {
+        if (is_valid(object)) { return object; }
+        ++number_of_rejections_;
+
+        switch (policy_) {
+        case Policy::truncate:
+            if (function.is_truncatable()) {
+                return function.generate_truncated(lower_bound_, upper_bound_);
+            }
+            return retry(object, function);
+        case Policy::clip:
+            return clip(object);
+        case Policy::reflect:
+            return reflect(object);
+        default:
+            return retry(object, function);
+        }
+    }
+/**
+@brief Return the number of generated objects out of the range.
+*/
+    unsigned long long number_of_rejections() const
+    {
+        return number_of_rejections_;
+    }
 
 private:
 
+    Object retry(Object object, Function<Object>& function)
+    {
+        for (unsigned int count = 0; count < max_retries_; ++count) {
+            object = function.generate();
+            if (is_valid(object)) { return object; }
+            ++number_of_rejections_;
+        }
+        return clip(object);
+    }
+    Object clip(Object object) const
+    {
+        // NaN goes to the lower bound
+        if (!(object >= lower_bound_)) { return lower_bound_; }
+        if (object > upper_bound_) { return upper_bound_; }
+        return object;
+    }
+    Object reflect(Object object) const
+    {
+        double width = upper_bound_ - lower_bound_;
+        double distance = std::abs(static_cast<double>(object) - lower_bound_);
+        if (!(width > 0) || !std::isfinite(distance)) { return clip(object); }
+
+        double offset = std::fmod(distance, 2 * width);
+        if (offset > width) { offset = 2 * width - offset; }
+        return clip(static_cast<Object>(lower_bound_ + offset));
+    }
+
 /// The lower bound of the object.
     Object lower_bound_;
 /// The upper bound of the object.
     Object upper_bound_;
+/// The policy to handle the object out of the range.
+    Policy policy_ = Policy::retry;
+/// The maximum number of retries of Policy::retry.
+    unsigned int max_retries_ = 1000;
+/// The number of generated objects out of the range.
+    unsigned long long number_of_rejections_ = 0;
 
 private:
 
@@ -186,6 +293,21 @@ its configuration should be
     {
         return true;
     }
+/**
+@brief Return the object.
+*/
+    Object enforce(Object object, Function<Object>& function)
+    {
+        return object;
+    }
+/**
+@brief Return the number of generated objects out of the range.
+@return always return 0.
+*/
+    unsigned long long number_of_rejections() const
+    {
+        return 0;
+    }
 
 private:
 
@@ -14,6 +14,7 @@
 #include "cm/cp/ControlParameter.h"
 #include "cm/cf/func/BaseFunction.h"
 #include "cm/cf/func/Function.h"
+#include "cm/cf/func/RecordTarget.h"
 #include "Population.h"
 
 namespace adef {
@@ -23,9 +24,8 @@ namespace adef {
 the condition of offspring is better than parent.
 
 @par Requirement
-Take out parameters from Parameters:
-- type @c std::size_t and name "target_index"
-.
+The target individual is given by IndividualContext::target_index.
+
 record parameters into Function:
 - name "object"
 .
@@ -67,19 +67,22 @@ its configuration should be
     {
     }
 
-    void select(std::shared_ptr<Repository> repos,
-                std::shared_ptr<BaseControlParameter> parameter,
-                std::shared_ptr<BaseFunction> function) const override
+    void select(const std::shared_ptr<Repository>& repos,
+                const IndividualContext& context,
+                const std::shared_ptr<BaseControlParameter>& parameter,
+                const std::shared_ptr<BaseFunction>& function) const override
     {
         auto param = std::dynamic_pointer_cast<ControlParameter<Object>>(parameter);
 
-        auto index = repos->parameters()->take_out<std::size_t>("target_index");
+        auto index = context.target_index;
         auto parent = repos->population()->at(index);
         auto offspring = repos->offspring()->at(index);
         if (offspring->fitness() < parent->fitness()) {
 
-            auto succ = function->record({param->load(index)},
-                                         parent, offspring, "object");
+            RecordValue values[] = { to_record_value(param->load(index)) };
+            auto succ = target_.resolve(*function).record(
+                                            RecordValues(values),
+                                            parent, offspring, target_.name());
             if (!succ) {
                 throw std::runtime_error(
                          "No functions accept parameters \"object\" "
@@ -87,9 +90,15 @@ its configuration should be
             }
         }
     }
+    void bind_function(const BaseFunction& function) override
+    {
+        target_.bind(function);
+    }
 
 private:
 
+    RecordTarget target_{"object"};
+
     std::shared_ptr<Prototype> clone_impl() const override
     {
         return std::make_shared<BetterOffspringControlSelection>(*this);
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include "Prototype.h"
+#include "IndividualContext.h"
 
 namespace adef {
 
@@ -53,9 +54,17 @@ If @em Class is derived from ControlSelection, its configuration should be
 /**
 @brief Check whether it is successful to the offspring.
 */
-    virtual void select(std::shared_ptr<Repository> repos,
-                        std::shared_ptr<BaseControlParameter> parameter,
-                        std::shared_ptr<BaseFunction> function) const = 0;
+    virtual void select(const std::shared_ptr<Repository>& repos,
+                        const IndividualContext& context,
+                        const std::shared_ptr<BaseControlParameter>& parameter,
+                        const std::shared_ptr<BaseFunction>& function) const = 0;
+/**
+@brief Resolve the Functions which receive record() in select().
+@param function The Function of any individual passed to select().
+
+The default does nothing.
+*/
+    virtual void bind_function(const BaseFunction& function) {}
 
 private:
 
@@ -45,9 +45,10 @@ NonInfoControlSelection's configuration should be
 */
     void setup(const Configuration& config, const PrototypeManager& pm) override;
 
-    void select(std::shared_ptr<Repository> repos,
-                std::shared_ptr<BaseControlParameter> parameter,
-                std::shared_ptr<BaseFunction> function) const override;
+    void select(const std::shared_ptr<Repository>& repos,
+                const IndividualContext& context,
+                const std::shared_ptr<BaseControlParameter>& parameter,
+                const std::shared_ptr<BaseFunction>& function) const override;
 
 private:
 
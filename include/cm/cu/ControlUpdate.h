@@ -3,6 +3,7 @@
 
 #include <memory>
 #include "Prototype.h"
+#include "IndividualContext.h"
 
 namespace adef {
 
@@ -56,9 +57,26 @@ its configuration should be
 /**
 @brief Update the internal states by given method.
 */
-    virtual void update(std::shared_ptr<Repository> repos,
-                        std::shared_ptr<BaseControlParameter> parameter,
-                        std::shared_ptr<BaseFunction> function) const = 0;
+    virtual void update(const std::shared_ptr<Repository>& repos,
+                        const IndividualContext& context,
+                        const std::shared_ptr<BaseControlParameter>& parameter,
+                        const std::shared_ptr<BaseFunction>& function) const = 0;
+/**
+@brief Return whether update() of an individual reads no objects of
+the other individuals.
+
+If all ControlUpdate of a ControlMechanism return @c true, the updates
+of all individuals may precede their generations, see
+ControlMechanism::update_and_generate_all(). It is @c false by default.
+*/
+    virtual bool is_independent() const { return false; }
+/**
+@brief Resolve the Functions which receive record() in update().
+@param function The Function of any individual passed to update().
+
+The default does nothing.
+*/
+    virtual void bind_function(const BaseFunction& function) {}
 
 private:
 
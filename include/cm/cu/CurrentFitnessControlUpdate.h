@@ -3,6 +3,7 @@
 
 #include <memory>
 #include "ControlUpdate.h"
+#include "cm/cf/func/RecordTarget.h"
 
 namespace adef {
 
@@ -17,9 +18,8 @@ class BaseFunction;
 the fitness value of current individual..
 
 @par Requirement
-Take out parameters from Parameters:
-- type @c std::size_t and name "target_index"
-.
+The target individual is given by IndividualContext::target_index.
+
 record parameters into Function:
 - name "current"
 .
@@ -55,9 +55,22 @@ its configuration should be
 */
     void setup(const Configuration& config, const PrototypeManager& pm) override;
 
-    void update(std::shared_ptr<Repository> repos,
-                std::shared_ptr<BaseControlParameter> parameter,
-                std::shared_ptr<BaseFunction> function) const override;
+    void update(const std::shared_ptr<Repository>& repos,
+                const IndividualContext& context,
+                const std::shared_ptr<BaseControlParameter>& parameter,
+                const std::shared_ptr<BaseFunction>& function) const override;
+/**
+@brief Return @c true, since it reads the fitness values only.
+*/
+    bool is_independent() const override { return true; }
+    void bind_function(const BaseFunction& function) override
+    {
+        target_.bind(function);
+    }
+
+private:
+
+    RecordTarget target_{"current"};
 
 private:
 
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include "ControlUpdate.h"
+#include "cm/cf/func/RecordTarget.h"
 
 namespace adef {
 
@@ -55,9 +56,22 @@ its configuration should be
 */
     void setup(const Configuration& config, const PrototypeManager& pm) override;
 
-    void update(std::shared_ptr<Repository> repos,
-                std::shared_ptr<BaseControlParameter> parameter,
-                std::shared_ptr<BaseFunction> function) const override;
+    void update(const std::shared_ptr<Repository>& repos,
+                const IndividualContext& context,
+                const std::shared_ptr<BaseControlParameter>& parameter,
+                const std::shared_ptr<BaseFunction>& function) const override;
+/**
+@brief Return @c true, since it reads the generation only.
+*/
+    bool is_independent() const override { return true; }
+    void bind_function(const BaseFunction& function) override
+    {
+        target_.bind(function);
+    }
+
+private:
+
+    RecordTarget target_{"generation"};
 
 private:
 
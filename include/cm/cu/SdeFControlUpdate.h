@@ -50,9 +50,10 @@ its configuration should be
 */
     void setup(const Configuration& config, const PrototypeManager& pm) override;
 
-    void update(std::shared_ptr<Repository> repos,
-        std::shared_ptr<BaseControlParameter> parameter,
-        std::shared_ptr<BaseFunction> function) const override;
+    void update(const std::shared_ptr<Repository>& repos,
+        const IndividualContext& context,
+        const std::shared_ptr<BaseControlParameter>& parameter,
+        const std::shared_ptr<BaseFunction>& function) const override;
 
 private:
 
@@ -96,22 +96,36 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
-        Object first = 0.0, second = 0.0;
+        Object sums[] = { 0.0, 0.0 };
         for (unsigned int i = 0; i < dimension_of_decision_space_; ++i) {
-            Object ind_i = individual->variables(i);
+            Object terms[2];
+            Ackley::separable_terms(individual.variables(i), i, terms);
 
-            first += ind_i * ind_i;
-            second += std::cos(2.0 * pi() * ind_i);
+            sums[0] += terms[0];
+            sums[1] += terms[1];
         }
-        Object sum = -20.0 * std::exp(-0.2 * std::sqrt(first / dimension_of_decision_space_)) -
-                     std::exp(second / dimension_of_decision_space_) +
+        Ackley::separable_objectives(sums, individual);
+    }
+
+    std::size_t number_of_separable_sums() const override { return 2; }
+    void separable_terms(Object variable, std::size_t dimension,
+                         Object* terms) const override
+    {
+        terms[0] = variable * variable;
+        terms[1] = std::cos(2.0 * pi() * variable);
+    }
+    void separable_objectives(const Object* sums,
+                              Individual& individual) const override
+    {
+        Object sum = -20.0 * std::exp(-0.2 * std::sqrt(sums[0] / dimension_of_decision_space_)) -
+                     std::exp(sums[1] / dimension_of_decision_space_) +
                      20.0 +
                      std::exp(1.0);
 
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
@@ -94,16 +94,16 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
-        Object sum = individual->variables(0) * individual->variables(0);
+        Object sum = individual.variables(0) * individual.variables(0);
         for (unsigned int idx = 1; idx < dimension_of_decision_space_; ++idx) {
 
             sum += 10.0 * 10.0 * 10.0 * 10.0 * 10.0 * 10.0 *
-                   individual->variables(idx) * individual->variables(idx);
+                   individual.variables(idx) * individual.variables(idx);
         }
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
@@ -72,10 +72,10 @@ Branin's configuration should be
         optimal_solution_ = 0.39788735772973816;
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
-        Object x1 = individual->variables(0),
-               x2 = individual->variables(1);
+        Object x1 = individual.variables(0),
+               x2 = individual.variables(1);
 
         Object first = x2 -
                        5.1 * x1 * x1 / (4.0 * pi() * pi()) +
@@ -86,8 +86,8 @@ Branin's configuration should be
                      10.0 * (1.0 - 1.0 / (8.0 * pi())) * std::cos(x1) +
                      10.0;
 
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
@@ -95,17 +95,17 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         Object sum = 10.0 * 10.0 * 10.0 * 10.0 * 10.0 * 10.0 *
-                     individual->variables(0) * individual->variables(0);
+                     individual.variables(0) * individual.variables(0);
 
         for (unsigned int idx = 1; idx < dimension_of_decision_space_; ++idx) {
 
-            sum += individual->variables(idx) * individual->variables(idx);
+            sum += individual.variables(idx) * individual.variables(idx);
         }
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
@@ -96,29 +96,29 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         Object inner = 0.0, outer = 0.0;
 
-        Object temp_sin = std::sin(pi() * y(individual->variables(0)));
+        Object temp_sin = std::sin(pi() * y(individual.variables(0)));
         inner += 10.0 * temp_sin * temp_sin;
         for (unsigned int idx = 0; idx < dimension_of_decision_space_ - 1; ++idx) {
-            Object temp = y(individual->variables(idx)) - 1;
-            Object temp_sin = std::sin(pi() * y(individual->variables(idx+1)));
+            Object temp = y(individual.variables(idx)) - 1;
+            Object temp_sin = std::sin(pi() * y(individual.variables(idx+1)));
             inner += temp * temp * (1.0 + 10.0 * temp_sin * temp_sin);
         }
 
-        Object temp = y(individual->variables(dimension_of_decision_space_ - 1)) - 1;
+        Object temp = y(individual.variables(dimension_of_decision_space_ - 1)) - 1;
         inner += temp * temp;
 
         for (unsigned int idx = 0; idx < dimension_of_decision_space_; ++idx) {
-            outer += u(individual->variables(idx), 10, 100, 4);
+            outer += u(individual.variables(idx), 10, 100, 4);
         }
 
         Object sum = pi() * inner / dimension_of_decision_space_ + outer;
 
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
@@ -97,29 +97,29 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         Object inner = 0.0, outer = 0.0;
 
-        Object temp = std::sin(3.0 * pi() * individual->variables(0));
+        Object temp = std::sin(3.0 * pi() * individual.variables(0));
         inner += temp * temp;
         for (unsigned int idx = 0; idx < dimension_of_decision_space_ - 1; ++idx) {
-            Object temp = individual->variables(idx) - 1;
-            Object temp_sin = std::sin(3.0 * pi() * individual->variables(idx+1));
+            Object temp = individual.variables(idx) - 1;
+            Object temp_sin = std::sin(3.0 * pi() * individual.variables(idx+1));
             inner += temp * temp * (1 + temp_sin * temp_sin);
         }
-        temp = individual->variables(dimension_of_decision_space_ - 1) - 1;
+        temp = individual.variables(dimension_of_decision_space_ - 1) - 1;
         Object temp_sin = std::sin(2.0 * pi() *
-                        individual->variables(dimension_of_decision_space_ - 1));
+                        individual.variables(dimension_of_decision_space_ - 1));
         inner += temp * temp * (1.0 + temp_sin * temp_sin);
 
         for (unsigned int idx = 0; idx < dimension_of_decision_space_; ++idx) {
-            outer += u(individual->variables(idx), 5, 100, 4);
+            outer += u(individual.variables(idx), 5, 100, 4);
         }
         Object sum = 0.1 * inner + outer;
 
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
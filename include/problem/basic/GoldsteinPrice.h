@@ -67,10 +67,10 @@ GoldsteinPrice's configuration should be
         optimal_solution_ = 3.0;
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
-        Object x1 = individual->variables(0),
-               x2 = individual->variables(1);
+        Object x1 = individual.variables(0),
+               x2 = individual.variables(1);
 
         Object first = x1 + x2 + 1.0,
                second = 2.0 * x1 - 3.0 * x2;
@@ -89,8 +89,8 @@ GoldsteinPrice's configuration should be
                                            27.0 * x2 * x2);
         Object sum = first * second;
 
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
@@ -95,21 +95,21 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         Object sum = 0.0;
         Object first = 0.0, second = 1.0;
 
         for (unsigned int idx = 0; idx < dimension_of_decision_space_; ++idx) {
-            Object ind_i = individual->variables(idx);
+            Object ind_i = individual.variables(idx);
 
             first += ind_i * ind_i;
             second *= std::cos(ind_i / std::sqrt(idx + 1.0));
         }
         sum = first / 4000.0 - second + 1.0;
 
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
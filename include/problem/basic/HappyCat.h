@@ -108,11 +108,11 @@ its configuration should be
                                 0.125 : alpha_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         Object sum = 0.0, sum_square = 0.0;
         for (unsigned int idx = 0; idx < dimension_of_decision_space_; ++idx) {
-            Object ind_i = individual->variables(idx);
+            Object ind_i = individual.variables(idx);
 
             sum += ind_i;
             sum_square += ind_i * ind_i;
@@ -122,8 +122,8 @@ its configuration should be
                         (0.5*sum_square + sum) / dimension_of_decision_space_ +
                         0.5;
 
-        individual->objectives() = result;
-        individual->set_fitness_value(result);
+        individual.objectives() = result;
+        individual.set_fitness_value(result);
     }
 
 private:
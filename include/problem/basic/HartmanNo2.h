@@ -73,7 +73,7 @@ HartmanNo2's configuration should be
         optimal_solution_ = -3.32;
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         const unsigned int n = 6, row = 4;
         std::array< std::array<Object, n>, row>
@@ -98,7 +98,7 @@ HartmanNo2's configuration should be
 
             Object inner = 0.0;
             for (unsigned int j = 0; j < n; ++j) {
-                Object temp = individual->variables(j) - p[i][j];
+                Object temp = individual.variables(j) - p[i][j];
                 inner += a[i][j] * temp * temp;
             }
             outer += c[i] * std::exp(0.0 - inner);
@@ -106,8 +106,8 @@ HartmanNo2's configuration should be
 
         Object sum = 0.0 - outer;
 
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
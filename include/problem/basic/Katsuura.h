@@ -95,7 +95,7 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         Object result = 1.0;
         for (unsigned int idx = 0; idx < dimension_of_decision_space_; ++idx) {
@@ -104,7 +104,7 @@ its configuration should be
             for (unsigned int j = 1; j <= 32; ++j) {
 
                 Object two_j = std::pow(2.0, static_cast<Object>(j));
-                Object two_j_x_i = two_j * individual->variables(idx);
+                Object two_j_x_i = two_j * individual.variables(idx);
                 inner += std::abs(two_j_x_i - std::floor(two_j_x_i + 0.5)) / two_j;
             }
 
@@ -115,8 +115,8 @@ its configuration should be
         Object temp = 10.0 / dimension_of_decision_space_ / dimension_of_decision_space_;
         Object sum = temp * result - temp;
 
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
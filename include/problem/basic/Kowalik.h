@@ -68,7 +68,7 @@ Kowalik's configuration should be
         optimal_solution_ = 0.0003075;
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         const unsigned int param_size = 11;
         std::array< Object , param_size>
@@ -86,17 +86,17 @@ Kowalik's configuration should be
         Object sum = 0.0;
         for (unsigned int i = 0; i < param_size; ++i) {
 
-            Object numerator = individual->variables(0) *
-                               (b[i] * b[i] + b[i] * individual->variables(1));
+            Object numerator = individual.variables(0) *
+                               (b[i] * b[i] + b[i] * individual.variables(1));
             Object denominator = b[i] * b[i] +
-                                 b[i] * individual->variables(2) +
-                                 individual->variables(3);
+                                 b[i] * individual.variables(2) +
+                                 individual.variables(3);
 
             Object temp = a[i] - numerator / denominator;
             sum += temp * temp;
         }
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
@@ -65,7 +65,10 @@ its configuration should be
 */
     void setup(const Configuration& config, const PrototypeManager& pm) override;
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override;
+    void evaluation_function(Individual& individual) const override;
+
+    bool is_shareable() const override { return false; }
+    bool is_deterministic() const override { return false; }
 
 private:
 
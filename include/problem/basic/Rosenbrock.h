@@ -94,21 +94,21 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         Object sum = 0.0;
         for (unsigned int idx = 0; idx < dimension_of_decision_space_ - 1; ++idx) {
 
-            Object ind_i = individual->variables(idx),
-                   ind_iplus1 = individual->variables(idx+1);
+            Object ind_i = individual.variables(idx),
+                   ind_iplus1 = individual.variables(idx+1);
 
             Object first_part = ind_iplus1 - ind_i * ind_i,
                    second_part = ind_i - 1.0;
 
             sum += 100.0 * first_part * first_part + second_part * second_part;
         }
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
@@ -95,18 +95,18 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         Object sum = 0.0;
         for (unsigned int i = 0; i < dimension_of_decision_space_; ++i) {
             Object inner_part = 0;
             for (unsigned int j = 0; j <= i; ++j) {
-                inner_part += individual->variables(j);
+                inner_part += individual.variables(j);
             }
             sum += inner_part * inner_part;
         }
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
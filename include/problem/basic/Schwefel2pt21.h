@@ -95,17 +95,17 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
-        Object max = std::abs(individual->variables(0));
+        Object max = std::abs(individual.variables(0));
         for (unsigned int idx = 1; idx < dimension_of_decision_space_; ++idx) {
-            Object temp = std::abs(individual->variables(idx));
+            Object temp = std::abs(individual.variables(idx));
             if (max < temp) {
                 max = temp;
             }
         }
-        individual->objectives() = max;
-        individual->set_fitness_value(max);
+        individual.objectives() = max;
+        individual.set_fitness_value(max);
     }
 
 private:
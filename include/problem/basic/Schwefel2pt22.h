@@ -95,16 +95,16 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         Object sum = 0.0, multi = 1.0;
         for (unsigned int idx = 0; idx < dimension_of_decision_space_; ++idx) {
-            Object abs_value = std::fabs(individual->variables(idx));
+            Object abs_value = std::fabs(individual.variables(idx));
             sum += abs_value;
             multi *= abs_value;
         }
-        individual->objectives() = sum + multi;
-        individual->set_fitness_value(sum + multi);
+        individual.objectives() = sum + multi;
+        individual.set_fitness_value(sum + multi);
     }
 
 private:
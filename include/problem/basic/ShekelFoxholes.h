@@ -68,7 +68,7 @@ ShekelFoxholes's configuration should be
         optimal_solution_ = 0.998004;
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         const unsigned int row_param = 2, col_param = 25;
         std::array< std::array<Object, col_param> , row_param> param_a =
@@ -87,15 +87,15 @@ ShekelFoxholes's configuration should be
         for (unsigned int j = 0; j < col_param; ++j) {
             Object i_part = 0.0;
             for (unsigned int i = 0; i < row_param; ++i) {
-                Object temp = individual->variables(i) - param_a[i][j];
+                Object temp = individual.variables(i) - param_a[i][j];
                 i_part += temp * temp * temp * temp * temp * temp;
             }
             right_part += 1.0 / ((j+1.0) + i_part);
         }
         Object sum = 1.0 / (0.002 + right_part);
 
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
@@ -69,7 +69,7 @@ ShekelNo3's configuration should be
         optimal_solution_ = -10.5364;
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         const unsigned int row = 10, col = 4;
         std::array< std::array<Object, col>, row>
@@ -94,7 +94,7 @@ ShekelNo3's configuration should be
             // calculate vector: x - a_i
             std::vector<Object> temp(dimension_of_decision_space_);
             for (unsigned int idx = 0; idx < dimension_of_decision_space_; ++idx) {
-                temp[idx] = individual->variables(idx) - a[i][idx];
+                temp[idx] = individual.variables(idx) - a[i][idx];
             }
             // calculate value: a inner dot b
             Object temp_value = 0.0;
@@ -106,8 +106,8 @@ ShekelNo3's configuration should be
             sum += 1.0 / temp_value;
         }
 
-        individual->objectives() = 0.0 - sum;
-        individual->set_fitness_value(0.0 - sum);
+        individual.objectives() = 0.0 - sum;
+        individual.set_fitness_value(0.0 - sum);
     }
 
 private:
@@ -67,10 +67,10 @@ SixHumpCamelBack's configuration should be
         optimal_solution_ = -1.031628453489877;
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
-        Object x1 = individual->variables(0),
-               x2 = individual->variables(1);
+        Object x1 = individual.variables(0),
+               x2 = individual.variables(1);
 
         Object sum = 4.0 * x1 * x1 -
                      2.1 * x1 * x1 * x1 * x1 +
@@ -79,8 +79,8 @@ SixHumpCamelBack's configuration should be
                      4.0 * x2 * x2 +
                      4.0 * x2 * x2 * x2 * x2;
 
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
     }
 
 private:
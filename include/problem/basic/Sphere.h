@@ -94,15 +94,36 @@ its configuration should be
                                 0.0 : optimal_config.get_value<Object>();
     }
 
-    void evaluation_function(std::shared_ptr<Individual> individual) const override
+    void evaluation_function(Individual& individual) const override
     {
         Object sum = 0.0;
         for (unsigned int idx = 0; idx < dimension_of_decision_space_; ++idx) {
 
-            sum += individual->variables(idx) * individual->variables(idx);
+            sum += term(individual.variables(idx));
         }
-        individual->objectives() = sum;
-        individual->set_fitness_value(sum);
+        individual.objectives() = sum;
+        individual.set_fitness_value(sum);
+    }
+
+    std::size_t number_of_separable_sums() const override { return 1; }
+    void separable_terms(Object variable, std::size_t dimension,
+                         Object* terms) const override
+    {
+        terms[0] = term(variable);
+    }
+    void separable_objectives(const Object* sums,
+                              Individual& individual) const override
+    {
+        individual.objectives() = sums[0];
+        individual.set_fitness_value(sums[0]);
+    }
+
+private:
+
+/// The term of the sum for a decision variable.
+    static Object term(Object variable)
+    {
+        return variable * variable;
     }
 
 private:
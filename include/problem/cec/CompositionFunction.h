@@ -0,0 +1,141 @@
+#ifndef COMPOSITION_FUNCTION_H
+#define COMPOSITION_FUNCTION_H
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include "problem/cec/TransformedProblem.h"
+#include "problem/cec/basic_functions.h"
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+
+/**
+@brief CompositionFunction is the weighted sum of the shifted and rotated
+basic functions, each of which has its own optimum, as the composition
+functions of CEC 2014.
+
+Each component @em i has its own shift <tt>o_i</tt> and rotation
+<tt>M_i</tt>, and
+<tt>F(x) = sum w_i (lambda_i f_i(M_i (x - o_i)) + bias_i) / sum w_i
++ optimal_solution</tt>, where the weight
+<tt>w_i = exp(-|x - o_i|^2 / (2 D sigma_i^2)) / |x - o_i|</tt>
+is large near <tt>o_i</tt>. The global optimum is the shift of
+the component of the least bias.
+Its name is "Composition" followed by the names of the basic functions,
+e.g., "CompositionRosenbrockEllipticBentCigar", see TransformedProblem
+for the rest of the name.
+
+@par The configuration
+CompositionFunction has extra configurations:
+- member
+    - name: "components"
+    - value: array configuration
+        - elements: object configuration
+            - member
+                - name: "function"
+                - value: @c string, see BasicFunction.
+            - member (optional)
+                - name: "sigma"
+                - value: @c double
+            - member (optional)
+                - name: "lambda"
+                - value: @c double
+            - member (optional)
+                - name: "bias"
+                - value: @c double
+.
+It has default configurations of each component @em i:
+- sigma: 10
+- lambda: 1
+- bias: 100 * i
+.
+It has the configurations of TransformedProblem.
+See setup() for the details.
+*/
+class CompositionFunction : public TransformedProblem
+{
+public:
+
+/// @copydoc Problem::Object
+    using Object = typename Problem::Object;
+
+    CompositionFunction() : TransformedProblem("Composition")
+    {
+    }
+    CompositionFunction(const CompositionFunction& rhs) = default;
+
+/**
+@brief Clone the current class.
+@sa clone_impl()
+*/
+    std::shared_ptr<CompositionFunction> clone() const
+    {
+        return std::dynamic_pointer_cast<CompositionFunction>(clone_impl());
+    }
+/**
+@brief Set up the internal states.
+
+If CompositionFunction has the following configuration, which is
+the function 23 of CEC 2014 without the different scales:
+- components:
+    - rosenbrock, sigma 10, lambda 1, bias 0
+    - elliptic, sigma 20, lambda 1e-6, bias 100
+    - bent_cigar, sigma 30, lambda 1e-26, bias 200
+- optimal_solution: 2300
+.
+its configuration should be
+- JSON configuration
+@code
+"Problem": {
+    "classname" : "CompositionFunction",
+    "components" : [
+        { "function" : "rosenbrock", "sigma" : 10, "lambda" : 1, "bias" : 0 },
+        { "function" : "elliptic", "sigma" : 20, "lambda" : 1e-6, "bias" : 100 },
+        { "function" : "bent_cigar", "sigma" : 30, "lambda" : 1e-26, "bias" : 200 }
+    ],
+    "optimal_solution" : 2300
+}
+@endcode
+.
+@exception std::domain_error It has no components.
+*/
+    void setup(const Configuration& config, const PrototypeManager& pm) override;
+
+protected:
+
+    std::size_t number_of_components() const override
+    {
+        return components_.size();
+    }
+    Object transformed_function(const Object* const* shifted,
+                                const Object* const* rotated,
+                                Object* workspace) const override;
+
+private:
+
+/// A basic function and its weight.
+    struct Component {
+
+        const BasicFunction* function;  ///< The basic function.
+        Object sigma;                   ///< The range of the weight.
+        Object lambda;                  ///< The scale of the function.
+        Object bias;                    ///< The bias of the function.
+    };
+
+/// The components.
+    std::vector<Component> components_;
+
+private:
+
+    std::shared_ptr<Prototype> clone_impl() const override
+    {
+        return std::make_shared<CompositionFunction>(*this);
+    }
+};
+
+}
+
+#endif
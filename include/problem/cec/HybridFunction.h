@@ -0,0 +1,118 @@
+#ifndef HYBRID_FUNCTION_H
+#define HYBRID_FUNCTION_H
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include "problem/cec/TransformedProblem.h"
+#include "problem/cec/basic_functions.h"
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+
+/**
+@brief HybridFunction evaluates the groups of the shifted and rotated
+decision variables by different basic functions, as the hybrid functions
+of CEC 2014.
+
+The rotated vector <tt>z = M (x - o)</tt> is permuted randomly by "seed",
+and divided into the groups of the sizes in "proportions". The group
+@em k is evaluated by the @em k-th function of "functions", and
+<tt>F(x) = f_1(z_1) + ... + f_K(z_K) + optimal_solution</tt>.
+The size of each group except the last one is the proportion of
+the dimension rounded up, and the last one has the rest.
+Its name is "Hybrid" followed by the names of the basic functions, e.g.,
+"HybridSchwefelRastriginElliptic", see TransformedProblem for the rest
+of the name.
+
+@par The configuration
+HybridFunction has extra configurations:
+- member
+    - name: "functions"
+    - value: array configuration
+        - elements: @c string, see BasicFunction.
+- member (optional)
+    - name: "proportions"
+    - value: array configuration
+        - elements: @c double
+.
+It has default configurations:
+- proportions: the equal proportions.
+.
+It has the configurations of TransformedProblem.
+See setup() for the details.
+*/
+class HybridFunction : public TransformedProblem
+{
+public:
+
+/// @copydoc Problem::Object
+    using Object = typename Problem::Object;
+
+    HybridFunction() : TransformedProblem("Hybrid")
+    {
+    }
+    HybridFunction(const HybridFunction& rhs) = default;
+
+/**
+@brief Clone the current class.
+@sa clone_impl()
+*/
+    std::shared_ptr<HybridFunction> clone() const
+    {
+        return std::dynamic_pointer_cast<HybridFunction>(clone_impl());
+    }
+/**
+@brief Set up the internal states.
+
+If HybridFunction has the following configuration, which is
+the function 17 of CEC 2014:
+- functions: schwefel, rastrigin, elliptic
+- proportions: 0.3, 0.3, 0.4
+- optimal_solution: 1700
+.
+its configuration should be
+- JSON configuration
+@code
+"Problem": {
+    "classname" : "HybridFunction",
+    "functions" : [ "schwefel", "rastrigin", "elliptic" ],
+    "proportions" : [ 0.3, 0.3, 0.4 ],
+    "optimal_solution" : 1700
+}
+@endcode
+.
+@exception std::domain_error The proportions do not match the functions,
+are not positive or sum to more than 1, or the groups exceed
+the dimension.
+*/
+    void setup(const Configuration& config, const PrototypeManager& pm) override;
+
+protected:
+
+    Object transformed_function(const Object* const* shifted,
+                                const Object* const* rotated,
+                                Object* workspace) const override;
+
+private:
+
+/// The basic function of each group.
+    std::vector<const BasicFunction*> functions_;
+/// The size of each group.
+    std::vector<std::size_t> sizes_;
+/// The permutation of the dimensions, shared by the clones.
+    std::shared_ptr<const std::vector<std::size_t>> permutation_;
+
+private:
+
+    std::shared_ptr<Prototype> clone_impl() const override
+    {
+        return std::make_shared<HybridFunction>(*this);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef SHIFTED_ROTATED_FUNCTION_H
+#define SHIFTED_ROTATED_FUNCTION_H
+
+#include <memory>
+#include "problem/cec/TransformedProblem.h"
+#include "problem/cec/basic_functions.h"
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+
+/**
+@brief ShiftedRotatedFunction is a basic function of the shifted and
+rotated decision variables,
+<tt>F(x) = f(M (x - o)) + optimal_solution</tt>.
+
+The rotation makes the separable functions, e.g., Rastrigin,
+non-separable. Its name is "ShiftedRotated" followed by the name of
+the basic function, e.g., "ShiftedRotatedRastrigin", see
+TransformedProblem for the rest of the name.
+
+@par The configuration
+ShiftedRotatedFunction has extra configurations:
+- member
+    - name: "function"
+    - value: @c string, see BasicFunction.
+.
+It has the configurations of TransformedProblem.
+See setup() for the details.
+*/
+class ShiftedRotatedFunction : public TransformedProblem
+{
+public:
+
+/// @copydoc Problem::Object
+    using Object = typename Problem::Object;
+
+    ShiftedRotatedFunction() : TransformedProblem("ShiftedRotated"),
+                               function_(nullptr)
+    {
+    }
+    ShiftedRotatedFunction(const ShiftedRotatedFunction& rhs) = default;
+
+/**
+@brief Clone the current class.
+@sa clone_impl()
+*/
+    std::shared_ptr<ShiftedRotatedFunction> clone() const
+    {
+        return std::dynamic_pointer_cast<ShiftedRotatedFunction>(clone_impl());
+    }
+/**
+@brief Set up the internal states.
+
+If ShiftedRotatedFunction has the following configuration:
+- function: rastrigin
+- dimension_of_decision_space: 30
+- optimal_solution: 900
+.
+its configuration should be
+- JSON configuration
+@code
+"Problem": {
+    "classname" : "ShiftedRotatedFunction",
+    "function" : "rastrigin",
+    "dimension_of_decision_space" : 30,
+    "optimal_solution" : 900
+}
+@endcode
+.
+*/
+    void setup(const Configuration& config, const PrototypeManager& pm) override;
+
+protected:
+
+    Object transformed_function(const Object* const* shifted,
+                                const Object* const* rotated,
+                                Object* workspace) const override;
+
+private:
+
+/// The basic function.
+    const BasicFunction* function_;
+
+private:
+
+    std::shared_ptr<Prototype> clone_impl() const override
+    {
+        return std::make_shared<ShiftedRotatedFunction>(*this);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef TRANSFORM_DATA_H
+#define TRANSFORM_DATA_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace adef {
+
+/**
+@brief TransformData holds the shift vectors and the rotation matrices of
+the components of a shifted and rotated problem.
+
+The data is read-only. generate() and load() return the same object for
+the same arguments as long as it is used, so all clones of the Problem,
+all runs and all experiments of the same data share it instead of
+copying @em D x @em D doubles each.
+
+Each rotation matrix is stored column by column, see multiply_columns().
+
+The data file of load() is raw doubles in the native byte order:
+the shift vectors of all components, then the rotation matrices of all
+components, each one column by column. On POSIX it is mapped into
+memory instead of read.
+*/
+class TransformData
+{
+public:
+
+/**
+@brief Generate the data from the seed.
+
+Each shift vector is uniform in <tt>[-80, 80]</tt>, and each rotation
+matrix is orthogonal, by the Gram-Schmidt process on a matrix of
+standard normal numbers. The same seed always gives the same data.
+@param dimension The dimension of the decision space.
+@param number_of_components The number of the shifts and rotations.
+@param seed The seed of the data.
+*/
+    static std::shared_ptr<const TransformData> generate(
+                                        std::size_t dimension,
+                                        std::size_t number_of_components,
+                                        unsigned int seed);
+/**
+@brief Load the data from the file.
+@param file_name The path of the data file.
+@param dimension The dimension of the decision space.
+@param number_of_components The number of the shifts and rotations.
+@exception std::runtime_error The file cannot be read or its size does
+           not match.
+*/
+    static std::shared_ptr<const TransformData> load(
+                                        const std::string& file_name,
+                                        std::size_t dimension,
+                                        std::size_t number_of_components);
+/**
+@brief Return a random permutation of the dimensions from the seed.
+*/
+    static std::vector<std::size_t> generate_permutation(std::size_t dimension,
+                                                         unsigned int seed);
+
+    TransformData(std::size_t dimension, std::size_t number_of_components);
+    ~TransformData();
+    TransformData(const TransformData& rhs) = delete;
+    TransformData& operator=(const TransformData& rhs) = delete;
+
+/**
+@brief Return the dimension of the decision space.
+*/
+    std::size_t dimension() const { return dimension_; }
+/**
+@brief Return the number of the shifts and rotations.
+*/
+    std::size_t number_of_components() const { return number_of_components_; }
+/**
+@brief Return the shift vector of the component.
+*/
+    const double* shift(std::size_t component) const
+    {
+        return data_ + component * dimension_;
+    }
+/**
+@brief Return the rotation matrix of the component, column by column.
+*/
+    const double* rotation(std::size_t component) const
+    {
+        return data_ + number_of_components_ * dimension_ +
+               component * dimension_ * dimension_;
+    }
+
+private:
+
+/**
+@brief Return the number of doubles of the data.
+*/
+    std::size_t size() const
+    {
+        return number_of_components_ * dimension_ * (dimension_ + 1);
+    }
+
+/// The dimension of the decision space.
+    std::size_t dimension_;
+/// The number of the shifts and rotations.
+    std::size_t number_of_components_;
+/// The shifts and the rotations, in storage_ or in the mapped file.
+    const double* data_;
+/// The generated or read data.
+    std::vector<double> storage_;
+/// The mapped file, or @c nullptr.
+    void* mapping_;
+/// The size of the mapped file.
+    std::size_t mapping_size_;
+};
+
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef TRANSFORMED_PROBLEM_H
+#define TRANSFORMED_PROBLEM_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "Problem.h"
+#include "problem/cec/TransformData.h"
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+class Individual;
+
+/**
+@brief TransformedProblem is the abstract base class of the CEC-style
+problems, which evaluate the decision variables after shifting and
+rotating them.
+
+For each component @em c of the TransformData, the individual @em x is
+transformed into
+- the shifted vector <tt>x - o_c</tt>, and
+- the rotated vector <tt>M_c (x - o_c)</tt>,
+.
+and transformed_function() evaluates them. The rotations of a batch of
+Evaluator are multiplied together by multiply_columns(), and the result
+of an individual is the same as evaluated alone.
+
+The TransformData is generated from "seed", or loaded from "data_file"
+if it is given. It is shared by the clones, so the Problem is shareable.
+
+The name of the derived class, e.g., "ShiftedRotatedRastrigin", is
+followed by "_" and "optimal_solution" if it is not zero, and by "_" and
+the name of "data_file" without the directories and the extension, or
+by "_seed" and "seed" if it is not the default, e.g.,
+"ShiftedRotatedRastrigin_900_seed3". So the problems of a suite have
+their own outputs. "name" replaces the whole name.
+
+@par The configuration
+TransformedProblem has extra configurations:
+- member (optional)
+    - name: "name"
+    - value: @c string
+- member (optional)
+    - name: "seed"
+    - value: <tt>unsigned int</tt>
+- member (optional)
+    - name: "data_file"
+    - value: @c string
+.
+It has fixed configurations:
+- kind: min
+- dimension_of_objective_space: 1
+.
+It has default configurations:
+- dimension_of_decision_space: 30
+- lower_bound_of_decision_space: -100.0
+- upper_bound_of_decision_space: 100.0
+- optimal_solution: 0.0, which is also the bias added to the function.
+- seed: 1
+.
+See setup() for the details.
+*/
+class TransformedProblem : public Problem
+{
+public:
+
+/// @copydoc Problem::Object
+    using Object = typename Problem::Object;
+
+/**
+@brief Construct a TransformedProblem with the name.
+*/
+    TransformedProblem(const std::string& name);
+    TransformedProblem(const TransformedProblem& rhs) = default;
+    virtual ~TransformedProblem() = default;
+
+/**
+@brief Clone the current class.
+@sa clone_impl()
+*/
+    std::shared_ptr<TransformedProblem> clone() const
+    {
+        return std::dynamic_pointer_cast<TransformedProblem>(clone_impl());
+    }
+/**
+@brief Set up the internal states.
+
+The derived class sets up its number_of_components() and its name
+before it.
+If @em Class is derived from TransformedProblem and has the following
+configuration:
+- dimension_of_decision_space: 30
+- optimal_solution: 100
+- seed: 3
+.
+its configuration should be
+- JSON configuration
+@code
+"Problem": {
+    "classname" : "Class",
+    "dimension_of_decision_space" : 30,
+    "optimal_solution" : 100,
+    "seed" : 3
+}
+@endcode
+.
+If the data is loaded from the file "M_30.bin" instead, see
+TransformData::load(), its configuration should be
+- JSON configuration
+@code
+"Problem": {
+    "classname" : "Class",
+    "dimension_of_decision_space" : 30,
+    "data_file" : "M_30.bin"
+}
+@endcode
+.
+*/
+    virtual void setup(const Configuration& config,
+                       const PrototypeManager& pm) override;
+
+    void evaluation_function(Individual& individual) const override;
+/**
+@brief Evaluate the individuals with the rotations multiplied together.
+*/
+    void evaluate_batch(const std::vector<Individual*>& individuals) const override;
+
+/**
+@brief Return the shifts and the rotations.
+*/
+    const TransformData& transform_data() const { return *data_; }
+
+protected:
+
+/**
+@brief Return the number of the shifts and rotations.
+*/
+    virtual std::size_t number_of_components() const { return 1; }
+/**
+@brief Evaluate the transformed individual.
+@param shifted The shifted vector of each component.
+@param rotated The rotated vector of each component.
+@param workspace The buffer of the dimension of the decision space.
+@return The objective value without the bias "optimal_solution".
+*/
+    virtual Object transformed_function(const Object* const* shifted,
+                                        const Object* const* rotated,
+                                        Object* workspace) const = 0;
+
+protected:
+
+/// The seed of the data.
+    unsigned int seed_;
+/// The shifts and rotations shared by the clones.
+    std::shared_ptr<const TransformData> data_;
+
+private:
+
+    std::shared_ptr<Prototype> clone_impl() const override = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef BASIC_FUNCTIONS_H
+#define BASIC_FUNCTIONS_H
+
+#include <string>
+#include <cstddef>
+
+namespace adef {
+
+/**
+@brief BasicFunction is a basic function of the CEC benchmarks, which is
+evaluated on the shifted and rotated vector.
+
+Each function scales the vector as the CEC 2014 benchmarks before
+the evaluation, e.g., Rastrigin maps <tt>[-100, 100]</tt> to
+<tt>[-5.12, 5.12]</tt>, so all of them fit the decision space
+<tt>[-100, 100]</tt>. The minimum of each one is zero at the zero vector,
+except that of "schwefel" is near zero.
+
+The functions:
+- "sphere", "elliptic" (high conditioned elliptic), "bent_cigar",
+  "discus": unimodal.
+- "rosenbrock", "ackley", "griewank", "rastrigin", "schwefel",
+  "katsuura", "happycat", "hgbat": multimodal.
+.
+*/
+struct BasicFunction {
+
+/// The name in the configuration, e.g., "rastrigin".
+    const char* name;
+/// The name of the problem, e.g., "Rastrigin".
+    const char* problem_name;
+/// Evaluate the vector of the dimension.
+    double (*evaluate)(const double* z, std::size_t dimension);
+};
+
+/**
+@brief Return the basic function of the name.
+@exception std::domain_error The name is not a basic function.
+*/
+const BasicFunction& find_basic_function(const std::string& name);
+
+}
+
+#endif
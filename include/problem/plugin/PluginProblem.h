@@ -0,0 +1,106 @@
+#ifndef PLUGIN_PROBLEM_H
+#define PLUGIN_PROBLEM_H
+
+#include <memory>
+#include <vector>
+#include "Problem.h"
+#include "adef_plugin.h"
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+class Individual;
+
+/**
+@brief PluginProblem is the problem of a plugin through the C ABI.
+
+It is registered by load_plugin() with the descriptor of the plugin,
+see adef_plugin.h. If the plugin has the batch evaluation function,
+the batch of Evaluator is copied into a contiguous matrix and evaluated
+by one call.
+
+@par The configuration
+PluginProblem has no extra configurations.@n
+It has default configurations from the descriptor:
+- kind
+- dimension_of_decision_space
+- lower_bound_of_decision_space
+- upper_bound_of_decision_space
+- dimension_of_objective_space
+- optimal_solution
+.
+See setup() for the details.
+*/
+class PluginProblem : public Problem
+{
+public:
+
+/// @copydoc Problem::Object
+    using Object = typename Problem::Object;
+
+/**
+@brief Construct the problem of the descriptor.
+@param descriptor The descriptor which is valid as long as the process.
+*/
+    explicit PluginProblem(const adef_plugin_problem* descriptor);
+    PluginProblem(const PluginProblem& rhs) = default;
+
+/**
+@brief Clone the current class.
+@sa clone_impl()
+*/
+    std::shared_ptr<PluginProblem> clone() const
+    {
+        return std::dynamic_pointer_cast<PluginProblem>(clone_impl());
+    }
+/**
+@brief Set up the internal states.
+
+If the plugin registers the problem "MySphere", and it has the following
+configuration:
+- dimension_of_decision_space: 10
+.
+its configuration should be
+- JSON configuration
+@code
+"plugins" : [ "./libmysphere.so" ],
+"System" : {
+    ...
+    "Problem": {
+        "classname" : "MySphere",
+        "dimension_of_decision_space" : 10
+    }
+    ...
+}
+@endcode
+.
+*/
+    void setup(const Configuration& config, const PrototypeManager& pm) override;
+
+    void evaluation_function(Individual& individual) const override;
+/**
+@brief Evaluate the individuals by the batch evaluation function of
+the plugin if it has one.
+*/
+    void evaluate_batch(const std::vector<Individual*>& individuals) const override;
+
+    bool is_deterministic() const override
+    {
+        return descriptor_->deterministic != 0;
+    }
+
+private:
+
+    std::shared_ptr<Prototype> clone_impl() const override
+    {
+        return std::make_shared<PluginProblem>(*this);
+    }
+
+/// The descriptor of the plugin.
+    const adef_plugin_problem* descriptor_;
+};
+
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef ADEF_PLUGIN_H
+#define ADEF_PLUGIN_H
+
+/*
+The C ABI of the problem plugins.
+
+A plugin is a shared library listed in the "plugins" of the
+configuration. If it exports the entry point ADEF_PLUGIN_ENTRY_NAME,
+the problems it returns are registered by their classname, e.g.,
+
+    static int sphere(void* context, const double* x, uint32_t dimension,
+                      double* objectives, uint32_t number_of_objectives)
+    {
+        double sum = 0;
+        for (uint32_t i = 0; i < dimension; ++i) { sum += x[i] * x[i]; }
+        objectives[0] = sum;
+        return 0;
+    }
+    static const adef_plugin_problem problems[] = {
+        { "MySphere", "My Sphere", ADEF_PLUGIN_MIN, 30, -100, 100, 1, 0.0,
+          1, NULL, sphere, NULL }
+    };
+    static const adef_plugin plugin = { ADEF_PLUGIN_ABI_VERSION, 1, problems };
+
+    ADEF_PLUGIN_EXPORT const adef_plugin* adef_plugin_entry(void)
+    {
+        return &plugin;
+    }
+
+The descriptors and the functions must be valid as long as the process
+runs, since the plugin is never unloaded. The functions may be called
+by several threads at the same time.
+
+Other prototypes, e.g., the functions of control mechanisms or the
+operators, are C++ classes registered by ADEF_REGISTER_TYPE() when the
+plugin is loaded; they need the same compiler and ADEF headers as the
+framework.
+*/
+
+#include <stdint.h>
+
+#define ADEF_PLUGIN_ABI_VERSION 1u
+#define ADEF_PLUGIN_ENTRY_NAME  "adef_plugin_entry"
+
+#define ADEF_PLUGIN_MIN 0
+#define ADEF_PLUGIN_MAX 1
+
+#if defined(_WIN32)
+#define ADEF_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define ADEF_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Evaluate an individual.
+Return zero on success.
+*/
+typedef int (*adef_evaluate_function)(void* context,
+                                      const double* variables,
+                                      uint32_t dimension,
+                                      double* objectives,
+                                      uint32_t number_of_objectives);
+/*
+Evaluate @c count individuals. The variables and the objectives are the
+row-major matrices of @c count rows.
+Return zero on success.
+*/
+typedef int (*adef_evaluate_batch_function)(void* context,
+                                            const double* variables,
+                                            uint32_t count,
+                                            uint32_t dimension,
+                                            double* objectives,
+                                            uint32_t number_of_objectives);
+
+/* The problem. The fitness is the first objective value. */
+typedef struct adef_plugin_problem {
+
+    const char* classname;   /* The registered name. */
+    const char* name;        /* The name of the problem. */
+    int kind;                /* ADEF_PLUGIN_MIN or ADEF_PLUGIN_MAX. */
+    /* The defaults, which the configuration may override. */
+    uint32_t dimension_of_decision_space;
+    double lower_bound_of_decision_space;
+    double upper_bound_of_decision_space;
+    uint32_t dimension_of_objective_space;
+    double optimal_solution;
+    int deterministic;       /* Nonzero if the same variables give the same
+                                objectives. */
+    void* context;           /* Passed to the functions. */
+    adef_evaluate_function evaluate;
+    adef_evaluate_batch_function evaluate_batch;  /* Optional. */
+
+} adef_plugin_problem;
+
+/* The plugin returned by the entry point. */
+typedef struct adef_plugin {
+
+    uint32_t abi_version;    /* ADEF_PLUGIN_ABI_VERSION */
+    uint32_t number_of_problems;
+    const adef_plugin_problem* problems;
+
+} adef_plugin;
+
+/* The entry point named ADEF_PLUGIN_ENTRY_NAME. */
+typedef const adef_plugin* (*adef_plugin_entry_function)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADEF_PLUGIN_H */
@@ -27,3 +27,13 @@
 #include "basic/HGBat.h"
 #include "basic/HappyCat.h"
 #include "basic/Katsuura.h"
+
+#include "cec/ShiftedRotatedFunction.h"
+#include "cec/HybridFunction.h"
+#include "cec/CompositionFunction.h"
+
+#include "plugin/PluginProblem.h"
+
+#ifdef ADEF_HAS_PROCESS_PROBLEM
+#include "process/ProcessProblem.h"
+#endif
@@ -0,0 +1,172 @@
+#ifndef PROCESS_PROBLEM_H
+#define PROCESS_PROBLEM_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "Problem.h"
+
+namespace adef {
+
+class Configuration;
+class PrototypeManager;
+class Individual;
+
+/**
+@brief ProcessProblem evaluates the individuals by the external programs.
+
+It spawns the long-lived worker processes by the command line, and
+streams the batches of decision variables to them over the shared
+memory. The protocol is described in process_protocol.h:
+the decision variables are written into the shared memory of a worker,
+and a small frame is written to the standard input of the worker as
+the doorbell; the worker writes the objective values back and echoes
+the frame to its standard output.
+
+The batch of Evaluator is split into the chunks of at most batch_size
+individuals, which are sent to the idle workers concurrently.
+If a worker exits, or it does not answer within the timeout of the
+chunk, it is killed and the individuals of the chunk get the penalty
+objective values and fitness. The worker is spawned again for the next
+chunk.
+
+The workers are spawned when the first individual is evaluated, and
+they belong to the copy which spawns them, so ProcessProblem is cloned
+for each run and island.
+
+The fitness is the first objective value.
+
+@par The configuration
+ProcessProblem has extra configurations:
+- command
+    - type: string
+    - value: the command line run by @c /bin/sh @c -c.
+- number_of_workers
+    - type: unsigned integer
+    - value: the number of worker processes.
+- batch_size
+    - type: unsigned integer
+    - value: the maximum number of individuals sent at a time.
+- timeout
+    - type: number
+    - value: the seconds to evaluate an individual. Zero means no timeout.
+- penalty
+    - type: number
+    - value: the objective values of the failed evaluations.
+.
+with the configurations of Problem.
+It has default configurations:
+- number_of_workers: 1
+- batch_size: 16
+- timeout: 0
+- penalty: the maximum of double.
+- dimension_of_objective_space: 1
+.
+See setup() for the details.
+*/
+class ProcessProblem : public Problem
+{
+public:
+
+/// @copydoc Problem::Object
+    using Object = typename Problem::Object;
+
+    ProcessProblem();
+    ProcessProblem(const ProcessProblem& rhs);
+    ~ProcessProblem();
+
+/**
+@brief Clone the current class.
+@sa clone_impl()
+*/
+    std::shared_ptr<ProcessProblem> clone() const
+    {
+        return std::dynamic_pointer_cast<ProcessProblem>(clone_impl());
+    }
+/**
+@brief Set up the internal states.
+
+If ProcessProblem has the following configuration:
+- command: "./worker"
+- number_of_workers: 4
+- batch_size: 8
+- timeout: 10
+- dimension_of_decision_space: 30
+- lower_bound_of_decision_space: -100
+- upper_bound_of_decision_space: 100
+.
+its configuration should be
+- JSON configuration
+@code
+"Problem": {
+    "classname" : "ProcessProblem",
+    "command" : "./worker",
+    "number_of_workers" : 4,
+    "batch_size" : 8,
+    "timeout" : 10,
+    "dimension_of_decision_space" : 30,
+    "lower_bound_of_decision_space" : -100,
+    "upper_bound_of_decision_space" : 100
+}
+@endcode
+.
+*/
+    void setup(const Configuration& config, const PrototypeManager& pm) override;
+
+    void evaluation_function(Individual& individual) const override;
+/**
+@brief Evaluate the individuals by the worker processes.
+*/
+    void evaluate_batch(const std::vector<Individual*>& individuals) const override;
+
+/**
+@brief The workers belong to one run.
+*/
+    bool is_shareable() const override { return false; }
+
+private:
+
+/// The worker process and its shared memory.
+    struct Worker;
+
+/**
+@brief Send the chunk to the worker.
+@return False if the worker can not receive it.
+*/
+    bool dispatch(Worker& worker, const std::vector<Individual*>& individuals,
+                  std::size_t first, std::size_t count) const;
+/**
+@brief Receive the results of the chunk from the worker.
+@return False if the worker fails.
+*/
+    bool receive(Worker& worker,
+                 const std::vector<Individual*>& individuals) const;
+/**
+@brief Give the penalty to the chunk of the worker and kill the worker.
+*/
+    void fail(Worker& worker,
+              const std::vector<Individual*>& individuals) const;
+
+    std::shared_ptr<Prototype> clone_impl() const override
+    {
+        return std::make_shared<ProcessProblem>(*this);
+    }
+
+/// The command line of workers.
+    std::string command_;
+/// The number of workers.
+    unsigned int number_of_workers_;
+/// The maximum number of individuals sent at a time.
+    std::size_t batch_size_;
+/// The seconds to evaluate an individual.
+    double timeout_;
+/// The objective values of the failed evaluations.
+    Object penalty_;
+/// The workers, spawned on demand.
+    mutable std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+}
+
+#endif
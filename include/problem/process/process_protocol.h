@@ -0,0 +1,72 @@
+#ifndef PROCESS_PROTOCOL_H
+#define PROCESS_PROTOCOL_H
+
+/*
+The protocol between ProcessProblem and its worker processes.
+
+It is plain C, so the workers in C, C++ or any language which can map
+the shared memory are able to include or mimic it.
+
+Each worker has its own POSIX shared memory object, whose name is given
+by the environment variable ADEF_SHM_NAME. The object is laid out as
+- the header adef_process_header,
+- the decision variables of max_batch individuals, one after another,
+- the objective values of max_batch individuals, one after another.
+.
+All values are the native double.
+
+The worker reads the frames adef_process_frame from its standard input.
+For each frame, it evaluates the first @c count individuals of the
+shared memory, writes their objective values, and writes the same frame
+back to its standard output. The end of the standard input means the
+worker should exit.
+*/
+
+#include <stdint.h>
+
+#define ADEF_PROCESS_MAGIC   0x46454441u  /* "ADEF" */
+#define ADEF_PROCESS_VERSION 1u
+#define ADEF_PROCESS_SHM_ENV "ADEF_SHM_NAME"
+
+/* The header at the beginning of the shared memory. */
+typedef struct adef_process_header {
+
+    uint32_t magic;       /* ADEF_PROCESS_MAGIC */
+    uint32_t version;     /* ADEF_PROCESS_VERSION */
+    uint64_t size;        /* The size of the shared memory in bytes. */
+    uint32_t dimension;   /* The number of decision variables. */
+    uint32_t objectives;  /* The number of objective values. */
+    uint32_t max_batch;   /* The maximum number of individuals in a batch. */
+    uint32_t reserved;
+
+} adef_process_header;
+
+/* The frame of a batch on the standard input and output. */
+typedef struct adef_process_frame {
+
+    uint32_t sequence;    /* Increased by one for each batch. */
+    uint32_t count;       /* The number of individuals in the batch. */
+
+} adef_process_frame;
+
+/* Return the decision variables in the shared memory. */
+static inline double* adef_process_variables(adef_process_header* header)
+{
+    return (double*)(header + 1);
+}
+/* Return the objective values in the shared memory. */
+static inline double* adef_process_objectives(adef_process_header* header)
+{
+    return adef_process_variables(header) +
+           (uint64_t)header->max_batch * header->dimension;
+}
+/* Return the size of the shared memory in bytes. */
+static inline uint64_t adef_process_size(uint32_t dimension,
+                                         uint32_t objectives,
+                                         uint32_t max_batch)
+{
+    return sizeof(adef_process_header) +
+           (uint64_t)max_batch * (dimension + objectives) * sizeof(double);
+}
+
+#endif /* PROCESS_PROTOCOL_H */
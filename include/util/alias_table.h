@@ -0,0 +1,89 @@
+#ifndef ALIAS_TABLE_H
+#define ALIAS_TABLE_H
+
+#include <vector>
+#include <cstddef>
+
+namespace adef {
+
+/**
+@brief AliasTable samples an index in proportion to its weight in O(1).
+
+It is the alias method of Walker, built by the algorithm of Vose in O(n).
+Each index @em i is split into the probability @c prob_[i] of itself and
+the rest of its alias @c alias_[i], so a sample needs one uniform number.
+*/
+class AliasTable
+{
+public:
+
+/**
+@brief Build the table from the weights.
+
+All weights must be positive. The order of the weights is the order of
+the indexes returned by sample().
+@param weights The weights of indexes.
+*/
+    template<typename Weight>
+    void build(const std::vector<Weight>& weights)
+    {
+        auto size = weights.size();
+        prob_.assign(size, 1);
+        alias_.resize(size);
+        small_.clear();
+        large_.clear();
+
+        double sum = 0;
+        for (auto&& weight : weights) { sum += weight; }
+
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            prob_[idx] = weights[idx] * size / sum;
+            alias_[idx] = idx;
+            if (prob_[idx] < 1) { small_.push_back(idx); }
+            else { large_.push_back(idx); }
+        }
+        while (!small_.empty() && !large_.empty()) {
+            auto less = small_.back();
+            small_.pop_back();
+            auto more = large_.back();
+
+            alias_[less] = more;
+            prob_[more] -= 1 - prob_[less];
+            if (prob_[more] < 1) {
+                large_.pop_back();
+                small_.push_back(more);
+            }
+        }
+        // the rest are 1 up to the rounding error
+        for (auto idx : large_) { prob_[idx] = 1; }
+        for (auto idx : small_) { prob_[idx] = 1; }
+    }
+/**
+@brief Return the index for the uniform number.
+@param u The uniform number in [0, size()).
+*/
+    std::size_t sample(double u) const
+    {
+        auto idx = static_cast<std::size_t>(u);
+        if (idx >= prob_.size()) { idx = prob_.size() - 1; }
+        return (u - idx < prob_[idx]) ? idx : alias_[idx];
+    }
+/**
+@brief Return the number of indexes.
+*/
+    std::size_t size() const { return prob_.size(); }
+
+private:
+
+/// The probability of each index to keep itself.
+    std::vector<double> prob_;
+/// The alternative of each index.
+    std::vector<std::size_t> alias_;
+/// The work lists of build(), kept to avoid allocations.
+    std::vector<std::size_t> small_;
+    std::vector<std::size_t> large_;
+};
+
+}
+
+#endif // ALIAS_TABLE_H
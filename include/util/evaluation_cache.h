@@ -0,0 +1,142 @@
+#ifndef EVALUATION_CACHE_H
+#define EVALUATION_CACHE_H
+
+#include <list>
+#include <vector>
+#include <unordered_map>
+#include <string_view>
+#include <functional>
+#include <iterator>
+#include <cstring>
+#include <cstddef>
+
+namespace adef {
+
+/**
+@brief EvaluationCache keeps the results of the latest evaluations.
+
+The entries are keyed on the bytes of the decision variables, so only
+the exactly identical individuals hit. At most capacity() entries are
+kept; inserting into a full cache reuses the least recently used entry,
+so the cache does not allocate after it becomes full unless the sizes
+of the variables change.
+
+The copy of a cache has the same capacity but no entries.
+*/
+class EvaluationCache
+{
+public:
+
+/// The result of an evaluation.
+    struct Entry {
+
+        std::vector<double> variables;   ///< The decision variables.
+        std::vector<double> objectives;  ///< The objective values.
+        double fitness;                  ///< The fitness value.
+    };
+
+/**
+@brief Construct the cache.
+@param capacity The maximum number of entries. Zero disables the cache.
+*/
+    explicit EvaluationCache(std::size_t capacity = 0) : capacity_(capacity)
+    {
+    }
+    EvaluationCache(const EvaluationCache& rhs) : capacity_(rhs.capacity_)
+    {
+    }
+    EvaluationCache& operator=(const EvaluationCache& rhs)
+    {
+        capacity_ = rhs.capacity_;
+        index_.clear();
+        entries_.clear();
+        return *this;
+    }
+
+/**
+@brief Return the entry of the decision variables, or @c nullptr.
+
+The found entry becomes the most recently used one.
+@param variables The decision variables.
+@param size The number of the decision variables.
+*/
+    const Entry* find(const double* variables, std::size_t size)
+    {
+        auto search = index_.find(Key{ variables, size });
+        if (search == index_.end()) { return nullptr; }
+        entries_.splice(entries_.begin(), entries_, search->second);
+        return &entries_.front();
+    }
+/**
+@brief Insert the result of an evaluation as the most recently used one.
+
+The decision variables must not be in the cache.
+*/
+    void insert(const double* variables, std::size_t size,
+                const double* objectives, std::size_t number_of_objectives,
+                double fitness)
+    {
+        if (capacity_ == 0) { return; }
+        if (entries_.size() < capacity_) {
+            entries_.emplace_front();
+        }
+        else {
+            // reuse the least recently used entry
+            auto& last = entries_.back();
+            index_.erase(Key{ last.variables.data(), last.variables.size() });
+            entries_.splice(entries_.begin(), entries_,
+                            std::prev(entries_.end()));
+        }
+        auto& entry = entries_.front();
+        entry.variables.assign(variables, variables + size);
+        entry.objectives.assign(objectives, objectives + number_of_objectives);
+        entry.fitness = fitness;
+        index_.emplace(Key{ entry.variables.data(), size }, entries_.begin());
+    }
+/**
+@brief Return the maximum number of entries.
+*/
+    std::size_t capacity() const { return capacity_; }
+/**
+@brief Return the number of entries.
+*/
+    std::size_t size() const { return entries_.size(); }
+
+private:
+
+/// The view of the decision variables.
+    struct Key {
+
+        const double* data;
+        std::size_t size;
+
+        std::string_view bytes() const
+        {
+            return { reinterpret_cast<const char*>(data),
+                     size * sizeof(double) };
+        }
+        bool operator==(const Key& rhs) const
+        {
+            return size == rhs.size &&
+                   std::memcmp(data, rhs.data, size * sizeof(double)) == 0;
+        }
+    };
+    struct KeyHash {
+
+        std::size_t operator()(const Key& key) const
+        {
+            return std::hash<std::string_view>()(key.bytes());
+        }
+    };
+
+/// The maximum number of entries.
+    std::size_t capacity_;
+/// The entries from the most recently used to the least one.
+    std::list<Entry> entries_;
+/// The entries keyed on their decision variables.
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+};
+
+}
+
+#endif // EVALUATION_CACHE_H
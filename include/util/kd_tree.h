@@ -0,0 +1,239 @@
+#ifndef KD_TREE_H
+#define KD_TREE_H
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace adef {
+
+/**
+@brief KdTree indexes the points with values for the nearest neighbor
+search.
+
+The points are inserted incrementally: a new point becomes a leaf which
+splits on the next dimension of its parent. If an insertion makes the
+tree too deep, the tree is rebuilt by splitting on the median of each
+level, so the depth stays O(log n) in amortized O(log n) per insertion.
+
+The nodes and the points are stored in arrays indexed by the order of
+insertion, and the search does not allocate if the result has the
+capacity of @em k neighbors.
+*/
+class KdTree
+{
+public:
+
+/// The neighbor found by nearest().
+    struct Neighbor {
+
+        double distance;     ///< The squared Euclidean distance.
+        std::size_t index;   ///< The index of the point.
+
+        bool operator<(const Neighbor& rhs) const
+        {
+            return distance < rhs.distance;
+        }
+    };
+
+/**
+@brief Construct the empty tree.
+@param dimension The dimension of the points.
+*/
+    explicit KdTree(std::size_t dimension = 0) : dimension_(dimension)
+    {
+    }
+
+/**
+@brief Remove all points and set the dimension of the points.
+*/
+    void clear(std::size_t dimension)
+    {
+        dimension_ = dimension;
+        points_.clear();
+        values_.clear();
+        nodes_.clear();
+        root_ = npos;
+    }
+/**
+@brief Return the number of points.
+*/
+    std::size_t size() const { return values_.size(); }
+/**
+@brief Return the dimension of the points.
+*/
+    std::size_t dimension() const { return dimension_; }
+/**
+@brief Return the point at the index.
+*/
+    const double* point(std::size_t index) const
+    {
+        return points_.data() + index * dimension_;
+    }
+/**
+@brief Return the value of the point at the index.
+*/
+    double value(std::size_t index) const { return values_[index]; }
+
+/**
+@brief Insert the point with its value.
+@param point The dimension() coordinates.
+@param value The value of the point.
+*/
+    void insert(const double* point, double value)
+    {
+        auto index = values_.size();
+        points_.insert(points_.end(), point, point + dimension_);
+        values_.push_back(value);
+        nodes_.push_back(Node{ npos, npos, 0 });
+
+        if (root_ == npos) {
+            root_ = index;
+            return;
+        }
+        std::size_t depth = 1;
+        auto parent = root_;
+        while (true) {
+            auto&& node = nodes_[parent];
+            auto& child = (point[node.split] < coordinate(parent, node.split)) ?
+                            node.left : node.right;
+            if (child == npos) {
+                child = index;
+                nodes_[index].split = (node.split + 1) % dimension_;
+                break;
+            }
+            parent = child;
+            ++depth;
+        }
+        if (depth > 2 * std::log2(values_.size()) + 8) { rebuild(); }
+    }
+/**
+@brief Remove the oldest points, which are inserted first.
+@param count The number of points to remove.
+*/
+    void erase_oldest(std::size_t count)
+    {
+        count = std::min(count, size());
+        points_.erase(points_.begin(), points_.begin() + count * dimension_);
+        values_.erase(values_.begin(), values_.begin() + count);
+        nodes_.resize(values_.size());
+        rebuild();
+    }
+/**
+@brief Find the nearest neighbors.
+@param point The dimension() coordinates.
+@param k The maximum number of neighbors.
+@param result The neighbors from the nearest one.
+*/
+    void nearest(const double* point, std::size_t k,
+                 std::vector<Neighbor>& result) const
+    {
+        result.clear();
+        if (k == 0) { return; }
+        search(root_, point, k, result);
+        std::sort_heap(result.begin(), result.end());
+    }
+
+private:
+
+/// The node of each point.
+    struct Node {
+
+        std::size_t left;
+        std::size_t right;
+        std::size_t split;  ///< The dimension to split.
+    };
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    double coordinate(std::size_t index, std::size_t dim) const
+    {
+        return points_[index * dimension_ + dim];
+    }
+    double squared_distance(const double* point, std::size_t index) const
+    {
+        double sum = 0;
+        auto rhs = this->point(index);
+        for (std::size_t dim = 0; dim < dimension_; ++dim) {
+            auto diff = point[dim] - rhs[dim];
+            sum += diff * diff;
+        }
+        return sum;
+    }
+
+/**
+@brief Search the subtree and keep the @a k nearest neighbors as
+a max-heap in @a result.
+*/
+    void search(std::size_t index, const double* point, std::size_t k,
+                std::vector<Neighbor>& result) const
+    {
+        if (index == npos) { return; }
+
+        Neighbor neighbor{ squared_distance(point, index), index };
+        if (result.size() < k) {
+            result.push_back(neighbor);
+            std::push_heap(result.begin(), result.end());
+        }
+        else if (neighbor < result.front()) {
+            std::pop_heap(result.begin(), result.end());
+            result.back() = neighbor;
+            std::push_heap(result.begin(), result.end());
+        }
+
+        auto&& node = nodes_[index];
+        auto diff = point[node.split] - coordinate(index, node.split);
+        auto near = diff < 0 ? node.left : node.right;
+        auto far = diff < 0 ? node.right : node.left;
+        search(near, point, k, result);
+        if (result.size() < k || diff * diff < result.front().distance) {
+            search(far, point, k, result);
+        }
+    }
+
+/**
+@brief Build the balanced tree of all points.
+*/
+    void rebuild()
+    {
+        order_.resize(values_.size());
+        std::iota(order_.begin(), order_.end(), 0);
+        root_ = build(0, order_.size(), 0);
+    }
+    std::size_t build(std::size_t first, std::size_t last, std::size_t split)
+    {
+        if (first >= last) { return npos; }
+        auto middle = first + (last - first) / 2;
+        std::nth_element(order_.begin() + first, order_.begin() + middle,
+                         order_.begin() + last,
+                         [&](std::size_t lhs, std::size_t rhs) {
+                             return coordinate(lhs, split) <
+                                    coordinate(rhs, split);
+                         });
+        auto index = order_[middle];
+        auto next = (split + 1) % dimension_;
+        nodes_[index].split = split;
+        nodes_[index].left = build(first, middle, next);
+        nodes_[index].right = build(middle + 1, last, next);
+        return index;
+    }
+
+/// The dimension of the points.
+    std::size_t dimension_;
+/// The coordinates of all points, one after another.
+    std::vector<double> points_;
+/// The value of each point.
+    std::vector<double> values_;
+/// The node of each point.
+    std::vector<Node> nodes_;
+/// The root node.
+    std::size_t root_ = npos;
+/// The work list of rebuild(), kept to avoid allocations.
+    std::vector<std::size_t> order_;
+};
+
+}
+
+#endif // KD_TREE_H
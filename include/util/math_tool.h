@@ -51,6 +51,57 @@ bool is_greater_equal(double lhs, double rhs) {
     return is_greater(lhs, rhs) || is_equal(lhs, rhs);
 }
 
+/**
+@brief Return the cumulative distribution function of
+the standard Normal distribution.
+*/
+inline
+double normal_cdf(double x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); }
+/**
+@brief Return the quantile function, i.e., the inverse of normal_cdf().
+
+It is the rational approximation of Acklam refined by one step of
+Halley's method, accurate to the precision of @c double.
+@param p The probability in [0, 1].
+*/
+inline
+double normal_quantile(double p)
+{
+    if (p <= 0) { return -std::numeric_limits<double>::infinity(); }
+    if (p >= 1) { return std::numeric_limits<double>::infinity(); }
+
+    const double a[] = { -3.969683028665376e+01,  2.209460984245205e+02,
+                         -2.759285104469687e+02,  1.383577518672690e+02,
+                         -3.066479806614716e+01,  2.506628277459239e+00 };
+    const double b[] = { -5.447609879822406e+01,  1.615858368580409e+02,
+                         -1.556989798598866e+02,  6.680131188771972e+01,
+                         -1.328068155288572e+01 };
+    const double c[] = { -7.784894002430293e-03, -3.223964580411365e-01,
+                         -2.400758277161838e+00, -2.549732539343734e+00,
+                          4.374664141464968e+00,  2.938163982698783e+00 };
+    const double d[] = {  7.784695709041462e-03,  3.224671290700398e-01,
+                          2.445134137142996e+00,  3.754408661907416e+00 };
+    const double p_low = 0.02425;
+
+    double x = 0;
+    if (p < p_low || p > 1 - p_low) {
+        double q = std::sqrt(-2 * std::log(p < p_low ? p : 1 - p));
+        x = (((((c[0]*q + c[1])*q + c[2])*q + c[3])*q + c[4])*q + c[5]) /
+            ((((d[0]*q + d[1])*q + d[2])*q + d[3])*q + 1);
+        if (p > 1 - p_low) { x = -x; }
+    }
+    else {
+        double q = p - 0.5;
+        double r = q * q;
+        x = (((((a[0]*r + a[1])*r + a[2])*r + a[3])*r + a[4])*r + a[5])*q /
+            (((((b[0]*r + b[1])*r + b[2])*r + b[3])*r + b[4])*r + 1);
+    }
+
+    double e = normal_cdf(x) - p;
+    double u = e * std::sqrt(2 * pi()) * std::exp(x * x / 2);
+    return x - u / (1 + x * u / 2);
+}
+
 }
 
 #endif // MATH_TOOL_H
@@ -0,0 +1,164 @@
+#ifndef SLIDING_QUANTILE_H
+#define SLIDING_QUANTILE_H
+
+#include <set>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cmath>
+#include <stdexcept>
+
+namespace adef {
+
+/**
+@brief SlidingQuantile keeps the quantile of a fixed number of slots.
+
+Every slot always holds a value. The values are split into two ordered
+sets: the lower one holds the smallest values up to the rank of the
+quantile, and the upper one holds the rest. Replacing the value of
+a slot moves the nodes between the sets, which costs O(log n) and
+reuses the nodes without allocations. quantile() reads the boundary of
+the sets in O(1).
+
+The quantile @em q of the sorted values @em v is interpolated linearly
+at the position <tt>q * (n-1)</tt>, so the 0.5-quantile is the median.
+@tparam T The type of the value. It must be arithmetic type.
+*/
+template<typename T>
+class SlidingQuantile
+{
+public:
+
+    SlidingQuantile() = default;
+/**
+@brief Construct the slots.
+@param size The number of slots.
+@param quantile The quantile in [0, 1].
+@param initial_value The value of all slots.
+*/
+    SlidingQuantile(std::size_t size, double quantile, T initial_value) :
+        quantile_(quantile), values_(size, initial_value)
+    {
+        if (!(quantile >= 0 && quantile <= 1)) {
+            throw std::logic_error("The quantile must be in [0, 1].");
+        }
+        rebuild();
+    }
+/**
+@brief The copy constructor. The sets are built again for the copy.
+*/
+    SlidingQuantile(const SlidingQuantile& rhs) :
+        quantile_(rhs.quantile_), values_(rhs.values_)
+    {
+        rebuild();
+    }
+    SlidingQuantile& operator=(const SlidingQuantile& rhs)
+    {
+        quantile_ = rhs.quantile_;
+        values_ = rhs.values_;
+        rebuild();
+        return *this;
+    }
+
+/**
+@brief Replace the value of the slot.
+*/
+    void replace(std::size_t slot, T value)
+    {
+        auto node = in_lower_[slot] ? lower_.extract(positions_[slot])
+                                    : upper_.extract(positions_[slot]);
+        node.value().first = value;
+        values_[slot] = value;
+
+        if (!lower_.empty() && node.value() < *lower_.rbegin()) {
+            positions_[slot] = lower_.insert(std::move(node)).position;
+            in_lower_[slot] = true;
+        }
+        else {
+            positions_[slot] = upper_.insert(std::move(node)).position;
+            in_lower_[slot] = false;
+        }
+        balance();
+    }
+/**
+@brief Return the quantile of the values of all slots.
+*/
+    T quantile() const
+    {
+        auto low = lower_.rbegin()->first;
+        if (fraction_ == 0 || upper_.empty()) { return low; }
+        auto high = upper_.begin()->first;
+        return static_cast<T>(low * (1 - fraction_) + high * fraction_);
+    }
+/**
+@brief Return the number of slots.
+*/
+    std::size_t size() const { return values_.size(); }
+
+private:
+
+/// The value and its slot, unique among the slots.
+    using Entry = std::pair<T, std::size_t>;
+    using Set = std::set<Entry>;
+
+/**
+@brief Build the sets from the values of slots.
+*/
+    void rebuild()
+    {
+        lower_.clear();
+        upper_.clear();
+        positions_.assign(values_.size(), typename Set::iterator());
+        in_lower_.assign(values_.size(), false);
+        if (values_.empty()) { return; }
+
+        auto position = quantile_ * (values_.size() - 1);
+        auto rank = static_cast<std::size_t>(std::floor(position));
+        fraction_ = position - rank;
+        lower_size_ = rank + 1;
+
+        for (std::size_t slot = 0; slot < values_.size(); ++slot) {
+            positions_[slot] = upper_.emplace(values_[slot], slot).first;
+        }
+        balance();
+    }
+/**
+@brief Move the boundary nodes until the lower set has the rank.
+*/
+    void balance()
+    {
+        while (lower_.size() > lower_size_) {
+            move(lower_, std::prev(lower_.end()), upper_, false);
+        }
+        while (lower_.size() < lower_size_) {
+            move(upper_, upper_.begin(), lower_, true);
+        }
+    }
+    void move(Set& from, typename Set::iterator it, Set& to, bool to_lower)
+    {
+        auto slot = it->second;
+        positions_[slot] = to.insert(from.extract(it)).position;
+        in_lower_[slot] = to_lower;
+    }
+
+/// The quantile.
+    double quantile_ = 0.5;
+/// The fractional part of the position of the quantile.
+    double fraction_ = 0;
+/// The number of values in the lower set.
+    std::size_t lower_size_ = 0;
+/// The value of each slot.
+    std::vector<T> values_;
+/// The smallest values up to the rank of the quantile.
+    Set lower_;
+/// The rest values.
+    Set upper_;
+/// The node of each slot.
+    std::vector<typename Set::iterator> positions_;
+/// Whether the node of each slot is in the lower set.
+    std::vector<bool> in_lower_;
+};
+
+}
+
+#endif // SLIDING_QUANTILE_H
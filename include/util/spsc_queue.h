@@ -0,0 +1,87 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+namespace adef {
+
+/**
+@brief SpscQueue is a bounded lock-free single-producer/single-consumer queue.
+
+Exactly one thread may call push() and exactly one thread may call pop().
+Neither of them blocks: push() fails if the queue is full and
+pop() fails if the queue is empty.
+*/
+template<typename T>
+class SpscQueue
+{
+public:
+
+/**
+@brief Construct the queue.
+@param capacity The maximum number of elements stored at the same time.
+*/
+    explicit SpscQueue(std::size_t capacity) :
+        buffer_(capacity + 1), head_(0), tail_(0)
+    {
+    }
+
+    SpscQueue(const SpscQueue& rhs) = delete;
+    SpscQueue& operator=(const SpscQueue& rhs) = delete;
+
+/**
+@brief Push an element into the queue (producer side).
+@return @c false if the queue is full, @c true otherwise.
+*/
+    bool push(T value)
+    {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        auto next = increment(tail);
+        if (next == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        buffer_[tail] = std::move(value);
+        tail_.store(next, std::memory_order_release);
+        return true;
+    }
+
+/**
+@brief Pop an element from the queue (consumer side).
+@param value The popped element if it succeeds.
+@return @c false if the queue is empty, @c true otherwise.
+*/
+    bool pop(T& value)
+    {
+        auto head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = std::move(buffer_[head]);
+        buffer_[head] = T();
+        head_.store(increment(head), std::memory_order_release);
+        return true;
+    }
+
+private:
+
+    std::size_t increment(std::size_t index) const
+    {
+        return (index + 1) % buffer_.size();
+    }
+
+private:
+
+/// The storage which has one more slot to distinguish full from empty.
+    std::vector<T> buffer_;
+/// The index of the next element to pop, written by the consumer.
+    alignas(64) std::atomic<std::size_t> head_;
+/// The index of the next slot to push, written by the producer.
+    alignas(64) std::atomic<std::size_t> tail_;
+};
+
+}
+
+#endif // SPSC_QUEUE_H
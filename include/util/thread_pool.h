@@ -0,0 +1,161 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <cstddef>
+
+namespace adef {
+
+/**
+@brief ThreadPool runs a loop across a fixed set of threads.
+
+The calling thread takes part in the work as the thread 0, so
+a ThreadPool with one thread has no worker and runs the loop inline.
+The indexes are split into contiguous blocks in the order of threads,
+i.e., the thread @em t handles
+<tt>[size * t / n, size * (t+1) / n)</tt> of @em n threads.
+*/
+class ThreadPool
+{
+public:
+
+/// The type of the loop body, called with the thread and the index.
+    using Task = std::function<void(unsigned int, std::size_t)>;
+
+/**
+@brief Construct the pool.
+@param number_of_threads The number of threads including the calling one.
+*/
+    explicit ThreadPool(unsigned int number_of_threads) :
+        task_(nullptr), size_(0), round_(0), pending_(0), stop_(false),
+        errors_(number_of_threads > 0 ? number_of_threads : 1)
+    {
+        for (unsigned int thread = 1; thread < number_of_threads; ++thread) {
+            workers_.emplace_back(&ThreadPool::work, this, thread);
+        }
+    }
+
+    ThreadPool(const ThreadPool& rhs) = delete;
+    ThreadPool& operator=(const ThreadPool& rhs) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+/**
+@brief Return the number of threads including the calling one.
+*/
+    unsigned int number_of_threads() const
+    {
+        return static_cast<unsigned int>(workers_.size() + 1);
+    }
+
+/**
+@brief Call @em task for each index in <tt>[0, size)</tt> and
+wait for all of them.
+
+The first exception thrown by the task is rethrown on the calling thread.
+*/
+    void parallel_for(std::size_t size, const Task& task)
+    {
+        if (workers_.empty()) {
+            for (std::size_t idx = 0; idx < size; ++idx) {
+                task(0, idx);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            size_ = size;
+            pending_ = workers_.size();
+            ++round_;
+        }
+        start_.notify_all();
+
+        run_block(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+        task_ = nullptr;
+        for (auto& error : errors_) {
+            if (error) {
+                auto first = error;
+                for (auto& e : errors_) { e = nullptr; }
+                std::rethrow_exception(first);
+            }
+        }
+    }
+
+private:
+
+    void work(unsigned int thread)
+    {
+        unsigned long seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_.wait(lock, [&] { return stop_ || round_ != seen; });
+                if (stop_) { return; }
+                seen = round_;
+            }
+
+            run_block(thread);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) { done_.notify_one(); }
+        }
+    }
+
+    void run_block(unsigned int thread)
+    {
+        auto n = number_of_threads();
+        auto begin = size_ * thread / n;
+        auto end = size_ * (thread + 1) / n;
+        try {
+            for (auto idx = begin; idx < end; ++idx) {
+                (*task_)(thread, idx);
+            }
+        }
+        catch (...) {
+            errors_[thread] = std::current_exception();
+        }
+    }
+
+private:
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+
+/// The current loop body, valid during parallel_for().
+    const Task* task_;
+/// The number of indexes of the current loop.
+    std::size_t size_;
+/// The counter of loops to wake up workers.
+    unsigned long round_;
+/// The number of workers which have not finished the current loop.
+    std::size_t pending_;
+    bool stop_;
+/// The exception thrown on each thread.
+    std::vector<std::exception_ptr> errors_;
+};
+
+}
+
+#endif // THREAD_POOL_H
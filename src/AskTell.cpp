@@ -0,0 +1,127 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include "AskTell.h"
+#include "adef.h"
+#include "System.h"
+#include "Experiment.h"
+#include "Repository.h"
+#include "Evolution.h"
+#include "IslandEvolution.h"
+#include "Population.h"
+#include "Individual.h"
+#include "Statistics.h"
+
+namespace adef {
+
+AskTell::AskTell(std::shared_ptr<Repository> repos) :
+    repos_(repos), generation_(0), asked_(false), terminated_(false)
+{
+    if (std::dynamic_pointer_cast<const IslandEvolution>(repos_->evolution())) {
+        throw std::logic_error("AskTell does not support IslandEvolution.");
+    }
+}
+
+std::shared_ptr<AskTell> AskTell::create(const std::string& config_file,
+                                         std::size_t experiment,
+                                         unsigned int run)
+{
+    auto system = make_system(config_file);
+    auto exp = system->make_experiment(experiment);
+    return std::make_shared<AskTell>(exp->prepare_run(run));
+}
+
+AskTell::Batch AskTell::ask()
+{
+    if (terminated_) { return Batch{ nullptr, 0, 0 }; }
+
+    if (!asked_) {
+        auto&& evolution = repos_->evolution();
+        if (generation_ == 0) {
+            evolution->initialize_population(repos_);
+        }
+        else {
+            evolution->reproduce_generation(repos_, generation_);
+        }
+        asked_ = true;
+
+        // the batch is never more than the budget of FEs
+        auto&& pop = batch_population();
+        variables_.resize(std::min<std::size_t>(
+            pop->population_size(),
+            repos_->statistics()->remaining_fitness_evaluations()));
+        for (std::size_t idx = 0; idx < variables_.size(); ++idx) {
+            variables_[idx] = pop->individual(idx).variable_data();
+        }
+    }
+
+    auto&& pop = batch_population();
+    auto dimension = pop->population_size() > 0 ?
+                        pop->individual(0).dimension_of_variable() : 0;
+    return Batch{ variables_.data(), variables_.size(), dimension };
+}
+
+void AskTell::tell(const double* fitness)
+{
+    if (!asked_) {
+        throw std::logic_error("AskTell::tell() is called without ask().");
+    }
+
+    auto&& pop = batch_population();
+    auto&& statistics = repos_->statistics();
+    for (std::size_t idx = 0; idx < pop->population_size(); ++idx) {
+        auto& individual = pop->individual(idx);
+        // the terms of separable problems are not evaluated
+        individual.separable_terms().clear();
+        individual.separable_sums().clear();
+        if (idx >= variables_.size()) {
+            // out of the budget of FEs, as Evaluator does
+            individual.set_fitness_value(std::numeric_limits<double>::max());
+            continue;
+        }
+        individual.objectives(0) = fitness[idx];
+        individual.set_fitness_value(fitness[idx]);
+        statistics->increase_number_of_fitness_evaluations();
+    }
+
+    auto&& evolution = repos_->evolution();
+    if (generation_ == 0) {
+        statistics->take_statistics(repos_);
+    }
+    else {
+        evolution->select_generation(repos_);
+    }
+    asked_ = false;
+    ++generation_;
+    terminated_ = generation_ > evolution->max_generation() ||
+                  evolution->is_evolve_terminated(repos_);
+    if (terminated_) {
+        evolution->record_stop_reason(repos_);
+    }
+}
+
+const Individual& AskTell::best() const
+{
+    auto pop = repos_->population();
+    if (generation_ == 0 || pop->population_size() == 0) {
+        throw std::logic_error("AskTell has no evaluated population.");
+    }
+    std::size_t best = 0;
+    for (std::size_t idx = 1; idx < pop->population_size(); ++idx) {
+        if (pop->individual(idx).fitness() < pop->individual(best).fitness()) {
+            best = idx;
+        }
+    }
+    return pop->individual(best);
+}
+
+const std::shared_ptr<Population>& AskTell::batch_population()
+{
+    return generation_ == 0 ? repos_->population() : repos_->offspring();
+}
+
+}
@@ -0,0 +1,320 @@
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <cstddef>
+#include "AsyncEvolution.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+#include "Repository.h"
+#include "Problem.h"
+#include "Population.h"
+#include "Individual.h"
+#include "Statistics.h"
+#include "Parameters.h"
+#include "DEMutation.h"
+#include "DECrossover.h"
+#include "Repair.h"
+#include "cm/ControlMechanism.h"
+#include "util/spsc_queue.h"
+
+namespace adef {
+
+namespace {
+
+/**
+@brief Backoff waits for the other threads by yielding, and then by
+sleeping for a short time.
+*/
+class Backoff
+{
+public:
+
+    void wait()
+    {
+        if (count_ < 64) {
+            ++count_;
+            std::this_thread::yield();
+        }
+        else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+    void reset() { count_ = 0; }
+
+private:
+
+    unsigned int count_ = 0;
+};
+
+/**
+@brief Worker evaluates the trial vectors of the slots sent to it.
+*/
+struct Worker {
+
+    Worker() : inbox(1), outbox(1) {}
+
+/// The slots to evaluate, from evolve() to the worker.
+    SpscQueue<std::size_t> inbox;
+/// The evaluated slots, from the worker to evolve().
+    SpscQueue<std::size_t> outbox;
+/// The Problem evaluated by the worker.
+    std::shared_ptr<const Problem> problem;
+/// The exception of the evaluation, sent with its slot.
+    std::exception_ptr error;
+/// Whether a slot is sent to the worker.
+    bool busy = false;
+    std::thread thread;
+};
+
+/**
+@brief WorkerPool runs the workers until it is destroyed.
+*/
+class WorkerPool
+{
+public:
+
+    WorkerPool(std::size_t size, std::shared_ptr<Repository> repos) :
+        stop_(false)
+    {
+        auto&& problem = repos->problem();
+        auto&& offspring = repos->offspring();
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            workers_.push_back(std::make_unique<Worker>());
+            workers_.back()->problem = problem->is_shareable() ?
+                problem : problem->clone();
+        }
+        bool serial = !problem->is_deterministic();
+        for (auto&& worker : workers_) {
+            auto raw = worker.get();
+            worker->thread = std::thread([this, raw, offspring, serial] {
+                run(*raw, *offspring, serial);
+            });
+        }
+    }
+    ~WorkerPool()
+    {
+        stop_.store(true, std::memory_order_release);
+        for (auto&& worker : workers_) {
+            if (worker->thread.joinable()) { worker->thread.join(); }
+        }
+    }
+    WorkerPool(const WorkerPool& rhs) = delete;
+    WorkerPool& operator=(const WorkerPool& rhs) = delete;
+
+    std::vector<std::unique_ptr<Worker>>& workers() { return workers_; }
+
+private:
+
+    void run(Worker& worker, Population& offspring, bool serial)
+    {
+        Backoff backoff;
+        std::size_t slot;
+        while (!stop_.load(std::memory_order_acquire)) {
+            if (!worker.inbox.pop(slot)) {
+                backoff.wait();
+                continue;
+            }
+            backoff.reset();
+            try {
+                if (serial) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    worker.problem->evaluate(offspring.individual(slot));
+                }
+                else {
+                    worker.problem->evaluate(offspring.individual(slot));
+                }
+            }
+            catch (...) {
+                worker.error = std::current_exception();
+            }
+            while (!worker.outbox.push(slot)) {
+                if (stop_.load(std::memory_order_acquire)) { return; }
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> stop_;
+/// It serializes the evaluations of the Problem which is not deterministic.
+    std::mutex mutex_;
+};
+
+}
+
+void AsyncEvolution::setup(const Configuration& config, const PrototypeManager& pm)
+{
+    Evolution::setup(config, pm);
+
+    auto workers_config = config.get_config("number_of_workers");
+    number_of_workers_ = workers_config.is_null() ?
+                            std::thread::hardware_concurrency() :
+                            workers_config.get_uint_value();
+    if (number_of_workers_ == 0) { number_of_workers_ = 1; }
+}
+
+void AsyncEvolution::evolve(std::shared_ptr<Repository> repos) const
+{
+    initialize_evolution(repos);
+    if (max_generation_ == 0 || is_evolve_terminated(repos)) {
+        record_stop_reason(repos);
+        return;
+    }
+
+    auto mutation = std::dynamic_pointer_cast<const DEMutation>(
+                        repos->mutation());
+    auto crossover = std::dynamic_pointer_cast<const DECrossover>(
+                        repos->crossover());
+    if (!mutation || !crossover) {
+        throw std::logic_error("AsyncEvolution requires DEMutation "
+                               "and DECrossover");
+    }
+    auto f = std::dynamic_pointer_cast<ControlMechanism<double>>(
+                repos->parameters()->take_out<
+                    std::shared_ptr<BaseControlMechanism>>("f"));
+    auto cr = std::dynamic_pointer_cast<ControlMechanism<double>>(
+                repos->parameters()->take_out<
+                    std::shared_ptr<BaseControlMechanism>>("cr"));
+
+    auto&& parent = *repos->population();
+    auto&& children = *repos->offspring();
+    auto&& problem = *repos->problem();
+    auto&& statistics = repos->statistics();
+    auto pop_size = parent.population_size();
+    if (pop_size != children.population_size()) {
+        throw std::runtime_error("The size of two Population are not equal");
+    }
+
+    std::size_t budget = static_cast<std::size_t>(max_generation_) * pop_size;
+    std::size_t dispatched = 0;
+    std::size_t completed = 0;
+    std::size_t next_slot = 0;
+    std::vector<char> in_flight(pop_size, 0);
+    std::vector<double> stat_F(pop_size);
+    std::vector<double> stat_CR(pop_size);
+    std::vector<double> stat_parents(pop_size);
+    // the fitness of the latest evaluated trial vector of each slot,
+    // since the trial vectors being evaluated are written by the workers
+    std::vector<double> stat_offspring(pop_size);
+    for (std::size_t idx = 0; idx < pop_size; ++idx) {
+        stat_offspring[idx] = parent.individual(idx).fitness();
+    }
+    unsigned int gen = 1;
+    bool stopping = false;
+
+    repos->parameters()->store("generation", gen);
+    repos->begin_generation(gen);
+
+    WorkerPool pool(std::min<std::size_t>(number_of_workers_, pop_size), repos);
+
+    // build the trial vector of the next free slot and send it
+    auto dispatch = [&](Worker& worker) {
+        if (stopping || dispatched >= budget ||
+            dispatched - completed >=
+                statistics->remaining_fitness_evaluations()) {
+            return false;
+        }
+        while (in_flight[next_slot]) { next_slot = (next_slot + 1) % pop_size; }
+        auto slot = next_slot;
+        next_slot = (next_slot + 1) % pop_size;
+
+        auto context = repos->context(slot);
+        auto&& trial = children.individual(slot);
+        f->update(repos, context);
+        stat_F[slot] = f->generate(repos, context);
+        mutation->mutate(context, parent, stat_F[slot], trial);
+        cr->update(repos, context);
+        stat_CR[slot] = cr->generate(repos, context);
+        crossover->crossover(context, parent, stat_CR[slot], trial);
+        repos->repair()->repair(trial, problem);
+
+        in_flight[slot] = 1;
+        ++dispatched;
+        worker.busy = true;
+        worker.inbox.push(slot);
+        return true;
+    };
+
+    // the statistics of the generation, without reading the offspring
+    auto take_statistics = [&] {
+        for (std::size_t idx = 0; idx < pop_size; ++idx) {
+            stat_parents[idx] = parent.individual(idx).fitness();
+        }
+        statistics->store_statistics_all_individuals(Statistics::Item::f,
+                                                     stat_F);
+        statistics->store_statistics_all_individuals(Statistics::Item::cr,
+                                                     stat_CR);
+        statistics->store_statistics_all_individuals(
+                                Statistics::Item::parents, stat_parents);
+        statistics->store_statistics_all_individuals(
+                                Statistics::Item::offspring, stat_offspring);
+        statistics->take_statistics(repos);
+    };
+
+    // the one-to-one selection of the evaluated trial vector
+    auto complete = [&](std::size_t slot) {
+        statistics->increase_number_of_fitness_evaluations();
+        auto context = repos->context(slot);
+        f->select(repos, context);
+        cr->select(repos, context);
+
+        auto&& target = parent.individual(slot);
+        auto&& trial = children.individual(slot);
+        stat_offspring[slot] = trial.fitness();
+        if (!(target.fitness() < trial.fitness())) { target = trial; }
+        in_flight[slot] = 0;
+
+        if (++completed % pop_size == 0) {
+            take_statistics();
+            if (is_evolve_terminated(repos)) { stopping = true; }
+
+            ++gen;
+            repos->parameters()->store("generation", gen);
+            repos->begin_generation(gen);
+        }
+    };
+
+    std::size_t running = 0;
+    for (auto&& worker : pool.workers()) {
+        if (dispatch(*worker)) { ++running; }
+    }
+
+    std::exception_ptr error;
+    Backoff backoff;
+    while (running > 0) {
+        bool progress = false;
+        for (auto&& worker : pool.workers()) {
+            std::size_t slot;
+            if (!worker->busy || !worker->outbox.pop(slot)) { continue; }
+            progress = true;
+            worker->busy = false;
+            --running;
+            if (worker->error) {
+                if (!error) { error = worker->error; }
+                worker->error = nullptr;
+                stopping = true;
+                in_flight[slot] = 0;
+                continue;
+            }
+            complete(slot);
+            if (dispatch(*worker)) { ++running; }
+        }
+        if (progress) { backoff.reset(); }
+        else { backoff.wait(); }
+    }
+    if (error) { std::rethrow_exception(error); }
+
+    // the last generation which is stopped by the budget of FEs
+    if (completed % pop_size != 0) {
+        take_statistics();
+    }
+    record_stop_reason(repos);
+}
+
+}
@@ -18,15 +18,15 @@ void BoundedRepair::init(std::shared_ptr<Repository> repos)
 {
 }
 
-void BoundedRepair::repair_function(std::shared_ptr<Individual> individual,
+void BoundedRepair::repair_function(Individual& individual,
                                     std::size_t dim,
-                                    std::shared_ptr<const Problem> problem) const
+                                    const Problem& problem) const
 {
-    auto gene = individual->variables(dim);
+    auto gene = individual.variables(dim);
 
     auto nearest_bound = Repair::find_nearest_bound(gene, problem, dim);
 
-    individual->variables(dim) = nearest_bound;
+    individual.variables(dim) = nearest_bound;
 }
 
 }
@@ -9,11 +9,8 @@
 namespace adef {
 
 Configuration::Configuration(const Configuration& rhs) :
-    builder_(rhs.builder_)
+    builder_(rhs.builder_), config_data_(rhs.config_data_)
 {
-    if (rhs.config_data_) {
-        config_data_ = rhs.config_data_->clone();
-    }
 }
 
 bool Configuration::load_config(const std::string& filename)
@@ -154,6 +151,27 @@ double Configuration::get_double_value(unsigned int index) const
     return get_config(index).get_double_value();
 }
 
+/*
+    for sweep
+*/
+
+unsigned int Configuration::get_sweep_size() const
+{
+    return builder_->get_sweep_size(config_data_);
+}
+
+Configuration Configuration::get_sweep_config(unsigned int index) const
+{
+    Configuration config = empty_clone();
+    config.config_data_ = builder_->get_sweep_config_data(index, config_data_);
+    return config;
+}
+
+std::string Configuration::get_sweep_label(unsigned int index) const
+{
+    return builder_->get_sweep_label(index, config_data_);
+}
+
 /*
     for value
 */
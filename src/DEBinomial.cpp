@@ -16,25 +16,39 @@ void DEBinomial::setup(const Configuration& config, const PrototypeManager& pm)
 
 void DEBinomial::init(std::shared_ptr<Repository> repos)
 {
-    random_ = repos->random();
 }
 
-std::shared_ptr<Individual> DEBinomial::crossover(
-                                std::shared_ptr<const Individual> mutant_vector,
-                                std::shared_ptr<const Individual> target_vector,
-                                double crossover_rate) const
+void DEBinomial::crossover(const IndividualContext& context,
+                           const Individual& mutant_vector,
+                           const Individual& target_vector,
+                           double crossover_rate,
+                           Individual& trial_vector) const
 {
-    auto trial = target_vector->clone();
+    std::size_t ind_size = mutant_vector.dimension_of_variable();
+    if (target_vector.dimension_of_variable() != ind_size ||
+        trial_vector.dimension_of_variable() != ind_size) {
+        throw std::logic_error("The size of two Individual are not equal");
+    }
+    auto mutant = mutant_vector.variable_data();
+    auto target = target_vector.variable_data();
+    auto trial = trial_vector.variable_data();
 
-    std::size_t ind_size = mutant_vector->dimension_of_variable();
-    std::size_t rnd = random_->random() % ind_size;
+    std::size_t rnd = context.random->random() % ind_size;
     std::uniform_real_distribution<> uniform(0, 1);
+    // each gene is read before it is written,
+    // so the trial vector may be one of the parents
     for (std::size_t idx = 0; idx < ind_size; ++idx) {
-        if ((random_->generate(uniform) < crossover_rate) || (rnd == idx)) {
-            trial->variables(idx) = mutant_vector->variables(idx);
+        if ((context.random->generate(uniform) < crossover_rate) || (rnd == idx)) {
+            trial[idx] = mutant[idx];
+        }
+        else {
+            trial[idx] = target[idx];
         }
     }
-    return trial;
+    for (std::size_t idx = 0; idx < target_vector.dimension_of_objective(); ++idx) {
+        trial_vector.objectives(idx) = target_vector.objectives(idx);
+    }
+    trial_vector.set_fitness_value(target_vector.fitness());
 }
 
 }
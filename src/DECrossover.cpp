@@ -28,42 +28,53 @@ void DECrossover::setup(const Configuration& config, const PrototypeManager& pm)
 void DECrossover::init(std::shared_ptr<Repository> repos)
 {
     variant_z_->init(repos);
+    cr_->init(repos);
     repos->parameters()->store("cr", cr_);
 }
 
 void DECrossover::crossover(std::shared_ptr<Repository> repos) const
 {
     auto cr = std::dynamic_pointer_cast<ControlMechanism<double>>(cr_);
-    std::vector<double> stat_CR;
 
     auto target = repos->population();
     auto trial = repos->offspring();
     std::size_t pop_size = target->population_size();
 
-    for (std::size_t idx = 0; idx < pop_size; ++idx) {
-
-        repos->parameters()->store("target_index", idx);
-
-        cr->update(repos);
-        auto crossover_rate = cr->generate(repos);
-
-        stat_CR.push_back(crossover_rate);
+    // the control mechanism may share states among individuals,
+    // so the parameters are updated and generated in the order of
+    // individuals unless the updates are independent
+    std::vector<double> stat_CR;
+    cr->update_and_generate_all(repos, pop_size, stat_CR);
+    // Here can NOT call cr->select() because offspring is incomplete
+    // see DEEnvironmentalSelection::select(repos)
 
-        *trial->at(idx) = *crossover(trial->at(idx),
-                                     target->at(idx),
-                                     crossover_rate);
-        // Here can NOT call cr->select(repos) because offspring is incomplete
-        // see DEEnvironmentalSelection::select(repos)
-    }
+    repos->for_each_individual(pop_size,
+        [&](const IndividualContext& context) {
+            auto idx = context.target_index;
+            crossover(context, *target, stat_CR[idx], trial->individual(idx));
+        });
     repos->statistics()->store_statistics_all_individuals(Statistics::Item::cr, stat_CR);
 }
 
+void DECrossover::crossover(const IndividualContext& context,
+                            const Population& target,
+                            double crossover_rate,
+                            Individual& trial_vector) const
+{
+    // the trial vector replaces the mutant vector in place
+    variant_z_->crossover(context, trial_vector,
+                          target.individual(context.target_index),
+                          crossover_rate, trial_vector);
+}
+
 std::shared_ptr<Individual> DECrossover::crossover(
+                                const IndividualContext& context,
                                 std::shared_ptr<const Individual> mutant_vector,
                                 std::shared_ptr<const Individual> target_vector,
                                 double crossover_rate) const
 {
-    return variant_z_->crossover(mutant_vector, target_vector, crossover_rate);
+    return variant_z_->crossover(context, mutant_vector, target_vector,
+                                 crossover_rate);
 }
 
 }
@@ -33,24 +33,27 @@ void DEEnvironmentalSelection::select(std::shared_ptr<Repository> repos) const
     if (pop_size != children->population_size()) {
         throw std::runtime_error("The size of two Population are not equal");
     }
-    for (decltype(pop_size) idx = 0; idx < pop_size; ++idx) {
-        repos->parameters()->store("target_index", idx);
-        f->select(repos);
-        cr->select(repos);
-
-        *parent->at(idx) = *select(parent->at(idx), children->at(idx));
-    }
+    // the control mechanisms see the parent and offspring before replacement
+    f->select_all(repos, pop_size);
+    cr->select_all(repos, pop_size);
+
+    repos->for_each_individual(pop_size,
+        [&](const IndividualContext& context) {
+            auto idx = context.target_index;
+            auto&& target = parent->individual(idx);
+            auto&& survivor = select(target, children->individual(idx));
+            if (&survivor != &target) { target = survivor; }
+        });
 }
 
-std::shared_ptr<Individual> DEEnvironmentalSelection::select(
-                                    std::shared_ptr<const Individual> lhs,
-                                    std::shared_ptr<const Individual> rhs) const
+const Individual& DEEnvironmentalSelection::select(const Individual& lhs,
+                                                   const Individual& rhs) const
 {
-    if (lhs->fitness() < rhs->fitness()) {
-        return lhs->clone();
+    if (lhs.fitness() < rhs.fitness()) {
+        return lhs;
     }
     else {
-        return rhs->clone();
+        return rhs;
     }
 }
 
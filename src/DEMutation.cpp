@@ -32,52 +32,56 @@ void DEMutation::setup(const Configuration& config,
 
 void DEMutation::init(std::shared_ptr<Repository> repos)
 {
+    f_->init(repos);
     repos->parameters()->store("f", f_);
-
-    random_ = repos->random();
 }
 
 void DEMutation::mutate(std::shared_ptr<Repository> repos) const
 {
     auto f = std::dynamic_pointer_cast<ControlMechanism<double>>(f_);
-    std::vector<double> stat_F;
 
     auto parent = repos->population();
     auto children = repos->offspring();
 
     std::size_t pop_size = parent->population_size();
-    for (std::size_t target_index = 0; target_index < pop_size; target_index++) {
-
-        repos->parameters()->store("target_index", target_index);
-
-        std::vector<std::size_t> used_indexes{target_index};
-
-        auto rnd_indexes = exclusive_random_number_generator(
-                                used_indexes, variant_x_->number_of_indexes(),
-                                0, parent->population_size());
-        auto base_vector = variant_x_->base_vector(
-                                            target_index, rnd_indexes, parent);
-
-        rnd_indexes = exclusive_random_number_generator(
-                                used_indexes, variant_y_->number_of_indexes(),
-                                0, parent->population_size());
-        auto difference_vector = variant_y_->difference_vector(rnd_indexes,
-                                                               parent);
 
-        f->update(repos);
-        auto scaling_factor = f->generate(repos);
-
-        stat_F.push_back(scaling_factor);
+    // the control mechanism may share states among individuals,
+    // so the parameters are updated and generated in the order of
+    // individuals unless the updates are independent
+    std::vector<double> stat_F;
+    f->update_and_generate_all(repos, pop_size, stat_F);
+    // Here can NOT call f->select() because offspring is incomplete
+    // see DEEnvironmentalSelection::select(repos)
+
+    repos->for_each_individual(pop_size,
+        [&](const IndividualContext& context) {
+            // the mutant vector is built in place in the offspring
+            auto target_index = context.target_index;
+            mutate(context, *parent, stat_F[target_index],
+                   children->individual(target_index));
+        });
 
-        *children->at(target_index) = *mutate(base_vector,
-                                              scaling_factor,
-                                              difference_vector);
-        // Here can NOT call f->select(repos) because offspring is incomplete
-        // see DEEnvironmentalSelection::select(repos)
-    }
     repos->statistics()->store_statistics_all_individuals(Statistics::Item::f, stat_F);
 }
 
+void DEMutation::mutate(const IndividualContext& context,
+                        const Population& parent,
+                        double F, Individual& mutant_vector) const
+{
+    auto target_index = context.target_index;
+    std::vector<std::size_t> used_indexes{target_index};
+
+    auto rnd_indexes = exclusive_random_number_generator(
+                        used_indexes, variant_x_->number_of_indexes(),
+                        0, parent.population_size(), context.random);
+    variant_x_->base_vector(target_index, rnd_indexes, parent, mutant_vector);
+
+    rnd_indexes = exclusive_random_number_generator(
+                        used_indexes, variant_y_->number_of_indexes(),
+                        0, parent.population_size(), context.random);
+    variant_y_->add_difference_vector(rnd_indexes, parent, F, mutant_vector);
+}
+
 std::shared_ptr<Individual> DEMutation::mutate(
         std::shared_ptr<const Individual> base_vector,
         double F,
@@ -94,14 +98,15 @@ std::vector<std::size_t> DEMutation::exclusive_random_number_generator(
                                        std::vector<std::size_t>& used_numbers,
                                        unsigned int number_of_result,
                                        unsigned int min_range,
-                                       unsigned int max_range) const
+                                       unsigned int max_range,
+                                       std::shared_ptr<Random> random) const
 {
     std::vector<std::size_t> result(number_of_result);
     for (auto& res : result) {
 
         std::size_t rnd = 0;
         for (std::size_t counter = 0; counter < used_numbers.size(); ) {
-            rnd = random_->random() % (max_range - min_range) + min_range;
+            rnd = random->random() % (max_range - min_range) + min_range;
             for (auto used : used_numbers) {
                 if (rnd == used) {
                     counter = 0;
@@ -18,13 +18,13 @@ unsigned int DERand::number_of_indexes() const
     return 1;
 }
 
-std::shared_ptr<Individual> DERand::base_vector(
-                            std::size_t target_index,
-                            const std::vector<std::size_t>& random_indexes,
-                            std::shared_ptr<const Population> population) const
+void DERand::base_vector(std::size_t target_index,
+                         const std::vector<std::size_t>& random_indexes,
+                         const Population& population,
+                         Individual& result) const
 {
     auto idx = random_indexes.front();
-    return population->at(idx)->clone();
+    result = population.individual(idx);
 }
 
 }
@@ -45,6 +45,40 @@ std::vector<std::shared_ptr<Individual>> DEVariantY::difference_vector(
     return difference;
 }
 
+void DEVariantY::add_difference_vector(
+                        const std::vector<std::size_t>& random_indexes,
+                        const Population& population,
+                        double F,
+                        Individual& mutant_vector) const
+{
+    std::size_t indexes_size = random_indexes.size();
+    if ((indexes_size % 2) != 0) {
+        throw std::logic_error("The number of random indexes required by \
+                               difference vector is not even.");
+    }
+    if ((indexes_size % number_of_difference_vector_) != 0) {
+        throw std::logic_error("The number of random indexes required by \
+                               difference vector is not to be divisible by \
+                               the number of difference vector.");
+    }
+
+    auto size = mutant_vector.dimension_of_variable();
+    auto mutant = mutant_vector.variable_data();
+    for (std::size_t i = 0, j = 1; i < indexes_size && j < indexes_size; i+=2, j+=2) {
+        auto&& terminal = population.individual(random_indexes[i]);
+        auto&& initial = population.individual(random_indexes[j]);
+        if (terminal.dimension_of_variable() != size ||
+            initial.dimension_of_variable() != size) {
+            throw std::logic_error("The size of two Individual are not equal");
+        }
+        auto lhs = terminal.variable_data();
+        auto rhs = initial.variable_data();
+        for (std::size_t idx = 0; idx < size; ++idx) {
+            mutant[idx] += (lhs[idx] - rhs[idx]) * F;
+        }
+    }
+}
+
 std::shared_ptr<Individual> DEVariantY::make_difference(
                             std::shared_ptr<const Individual> terminal,
                             std::shared_ptr<const Individual> initial) const
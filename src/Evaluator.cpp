@@ -1,16 +1,43 @@
 #include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <stdexcept>
 #include "Evaluator.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "Repository.h"
 #include "Problem.h"
 #include "Population.h"
+#include "Individual.h"
 #include "Statistics.h"
 
 namespace adef {
 
 void Evaluator::setup(const Configuration& config, const PrototypeManager& pm)
 {
+    auto cache_size_config = config.get_config("cache_size");
+    auto cache_size = cache_size_config.is_null() ?
+                        0 : cache_size_config.get_uint_value();
+    cache_ = EvaluationCache(cache_size);
+
+    auto skip_unchanged_config = config.get_config("skip_unchanged");
+    skip_unchanged_ = skip_unchanged_config.is_null() ?
+                        false : skip_unchanged_config.get_bool_value();
+
+    auto delta_evaluation_config = config.get_config("delta_evaluation");
+    delta_evaluation_ = delta_evaluation_config.is_null() ?
+                        false : delta_evaluation_config.get_bool_value();
+
+    auto delta_evaluation_check_config =
+                                config.get_config("delta_evaluation_check");
+    delta_evaluation_check_ = delta_evaluation_check_config.is_null() ?
+                        false : delta_evaluation_check_config.get_bool_value();
 }
 
 void Evaluator::init(std::shared_ptr<Repository> repos)
@@ -18,13 +45,161 @@ void Evaluator::init(std::shared_ptr<Repository> repos)
 }
 
 void Evaluator::evaluate(std::shared_ptr<Population> pop,
+                         std::shared_ptr<const Population> targets,
                          std::shared_ptr<const Problem> problem,
                          std::shared_ptr<Statistics> statistics) const
 {
+    bool deterministic = problem->is_deterministic();
+    bool use_targets = deterministic && skip_unchanged_ && targets;
+    bool use_cache = deterministic && cache_.capacity() > 0;
+    bool use_delta = delta_evaluation_ &&
+                     problem->number_of_separable_sums() > 0;
+    std::vector<std::size_t> changed_indexes;
+    std::vector<Individual*> pending;
+    // the duplicates of the pending individuals in this population
+    std::unordered_map<std::string_view, Individual*> pending_variables;
+    std::vector<std::pair<Individual*, Individual*>> duplicates;
+    auto remaining = statistics->remaining_fitness_evaluations();
+
     auto size = pop->population_size();
     for (decltype(size) idx = 0; idx < size; ++idx) {
-        problem->evaluate(pop->at(idx));
+        auto&& individual = pop->individual(idx);
+        if ((use_targets &&
+                reuse_target(individual, targets->individual(idx))) ||
+            (use_cache && reuse_cache(individual))) {
+            statistics->increase_number_of_cache_hits();
+            continue;
+        }
+        if (pending.size() >= remaining) {
+            // out of the budget of FEs, it loses against any individual
+            individual.set_fitness_value(std::numeric_limits<double>::max());
+            individual.separable_terms().clear();
+            individual.separable_sums().clear();
+            continue;
+        }
+        if (use_cache) {
+            std::string_view bytes(
+                reinterpret_cast<const char*>(individual.variable_data()),
+                individual.dimension_of_variable() *
+                    sizeof(Individual::VariableType));
+            auto search = pending_variables.emplace(bytes, &individual);
+            if (!search.second) {
+                duplicates.emplace_back(&individual, search.first->second);
+                continue;
+            }
+        }
+
+        if (use_delta) {
+            evaluate_delta(individual,
+                           targets ? &targets->individual(idx) : nullptr,
+                           *problem, changed_indexes);
+        }
+        pending.push_back(&individual);
+    }
+
+    // the others are evaluated together, e.g., by the worker processes
+    if (!use_delta) {
+        problem->evaluate_batch(pending);
+    }
+    for (auto individual : pending) {
         statistics->increase_number_of_fitness_evaluations();
+        if (use_cache) {
+            cache_.insert(individual->variable_data(),
+                          individual->dimension_of_variable(),
+                          individual->objective_data(),
+                          individual->dimension_of_objective(),
+                          individual->fitness());
+        }
+    }
+    for (auto&& duplicate : duplicates) {
+        reuse_target(*duplicate.first, *duplicate.second);
+        statistics->increase_number_of_cache_hits();
+    }
+}
+
+bool Evaluator::reuse_target(Individual& individual,
+                             const Individual& target) const
+{
+    auto size = individual.dimension_of_variable();
+    if (target.dimension_of_variable() != size ||
+        std::memcmp(individual.variable_data(), target.variable_data(),
+                    size * sizeof(Individual::VariableType)) != 0) {
+        return false;
+    }
+    for (std::size_t idx = 0; idx < target.dimension_of_objective(); ++idx) {
+        individual.objectives(idx) = target.objectives(idx);
+    }
+    individual.set_fitness_value(target.fitness());
+    individual.separable_terms() = target.separable_terms();
+    individual.separable_sums() = target.separable_sums();
+    return true;
+}
+
+bool Evaluator::reuse_cache(Individual& individual) const
+{
+    auto entry = cache_.find(individual.variable_data(),
+                             individual.dimension_of_variable());
+    if (!entry) { return false; }
+    for (std::size_t idx = 0; idx < entry->objectives.size(); ++idx) {
+        individual.objectives(idx) = entry->objectives[idx];
+    }
+    individual.set_fitness_value(entry->fitness);
+    // the cache has no terms of separable problems
+    individual.separable_terms().clear();
+    individual.separable_sums().clear();
+    return true;
+}
+
+void Evaluator::evaluate_delta(Individual& individual,
+                              const Individual* target,
+                              const Problem& problem,
+                              std::vector<std::size_t>& changed_indexes) const
+{
+    auto size = individual.dimension_of_variable();
+    if (target && problem.has_separable_terms(*target) &&
+        target->dimension_of_variable() == size) {
+
+        changed_indexes.clear();
+        auto lhs = individual.variable_data();
+        auto rhs = target->variable_data();
+        for (std::size_t dim = 0; dim < size; ++dim) {
+            if (std::memcmp(lhs + dim, rhs + dim,
+                            sizeof(Individual::VariableType)) != 0) {
+                changed_indexes.push_back(dim);
+            }
+        }
+        // otherwise the evaluation from scratch is as fast and
+        // does not accumulate the rounding errors
+        if (changed_indexes.size() * 2 <= size) {
+            problem.evaluate_partially(individual, *target, changed_indexes);
+            if (delta_evaluation_check_) {
+                check_delta(individual, problem);
+            }
+            return;
+        }
+    }
+    problem.evaluate_separably(individual);
+}
+
+void Evaluator::check_delta(const Individual& individual,
+                            const Problem& problem) const
+{
+    Individual full(individual);
+    problem.evaluate_separably(full);
+
+    // both sums have the rounding errors of their magnitudes
+    auto number_of_sums = problem.number_of_separable_sums();
+    auto&& sums = individual.separable_sums();
+    auto&& full_sums = full.separable_sums();
+    auto tolerance = 2.0 * individual.dimension_of_variable() *
+                     std::numeric_limits<Individual::ObjectiveType>::epsilon();
+    for (std::size_t idx = 0; idx < number_of_sums; ++idx) {
+        if (std::fabs(sums[idx] - full_sums[idx]) >
+                tolerance * full_sums[number_of_sums + idx]) {
+            throw std::runtime_error("The delta evaluation of the Problem \"" +
+                                     problem.name() + "\" differs from "
+                                     "the evaluation from scratch.");
+        }
     }
 }
 
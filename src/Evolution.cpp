@@ -5,6 +5,7 @@
 #include "Repository.h"
 #include "Initializer.h"
 #include "Evaluator.h"
+#include "Surrogate.h"
 #include "Reproduction.h"
 #include "EnvironmentalSelection.h"
 #include "Problem.h"
@@ -25,9 +26,21 @@ void Evolution::init(std::shared_ptr<Repository> repos)
 
 void Evolution::evolve(std::shared_ptr<Repository> repos) const
 {
+    initialize_evolution(repos);
 
-    // initialization
-    repos->initializer()->initialize(repos);
+    // for each generation
+    unsigned int gen = 1;
+    while (gen <= max_generation_ && !is_evolve_terminated(repos)) {
+        evolve_generation(repos, gen);
+        // increase generation
+        ++gen;
+    }
+    record_stop_reason(repos);
+}
+
+void Evolution::initialize_evolution(std::shared_ptr<Repository> repos) const
+{
+    initialize_population(repos);
 
     // evaluation
     repos->evaluator()->evaluate(repos->population(),
@@ -35,38 +48,64 @@ void Evolution::evolve(std::shared_ptr<Repository> repos) const
                                  repos->statistics());
 
     repos->statistics()->take_statistics(repos);
+}
 
-    // for each generation
-    unsigned int gen = 1;
-    while (gen <= max_generation_ && !is_evolve_terminated(repos)) {
-        repos->parameters()->store("generation", gen);
-
-        // reproduction
-        repos->reproduction()->reproduce(repos);
+void Evolution::evolve_generation(std::shared_ptr<Repository> repos,
+                                  unsigned int gen) const
+{
+    reproduce_generation(repos, gen);
 
+    if (auto&& surrogate = repos->surrogate()) {
+        surrogate->evaluate(repos);
+    }
+    else {
         repos->evaluator()->evaluate(repos->offspring(),
+                                     repos->population(),
                                      repos->problem(),
                                      repos->statistics());
+    }
 
-        repos->statistics()->post_reproduction_statistic(repos);
+    select_generation(repos);
+}
 
-        // environmental selection
-        repos->environmental_selection()->select(repos);
+void Evolution::initialize_population(std::shared_ptr<Repository> repos) const
+{
+    repos->begin_generation(0);
 
-        repos->statistics()->take_statistics(repos);
-        // increase generation
-        ++gen;
-    }
+    // initialization
+    repos->initializer()->initialize(repos);
+}
+
+void Evolution::reproduce_generation(std::shared_ptr<Repository> repos,
+                                     unsigned int gen) const
+{
+    repos->parameters()->store("generation", gen);
+    repos->begin_generation(gen);
+
+    // reproduction
+    repos->reproduction()->reproduce(repos);
+}
+
+void Evolution::select_generation(std::shared_ptr<Repository> repos) const
+{
+    repos->statistics()->post_reproduction_statistic(repos);
+
+    // environmental selection
+    repos->environmental_selection()->select(repos);
+
+    repos->statistics()->take_statistics(repos);
 }
 
 bool Evolution::is_evolve_terminated(std::shared_ptr<const Repository> repos) const
 {
-    if (repos->statistics()->is_evolve_success(repos)) {
-        return true;
-    }
-    else {
-        return false;
-    }
+    return !repos->statistics()->termination_reason(repos).empty();
+}
+
+void Evolution::record_stop_reason(std::shared_ptr<Repository> repos) const
+{
+    auto&& statistics = repos->statistics();
+    auto reason = statistics->termination_reason(repos);
+    statistics->set_stop_reason(reason.empty() ? "max_generation" : reason);
 }
 
 }
@@ -1,5 +1,9 @@
+#include <memory>
 #include <string>
 #include <sstream>
+#include <stdexcept>
+#include <cstring>
+#include <cstddef>
 #include "Experiment.h"
 #include "Random.h"
 #include "ExperimentalStatistics.h"
@@ -8,6 +12,9 @@
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "Evolution.h"
+#include "Statistics.h"
+#include "Population.h"
+#include "Individual.h"
 
 namespace adef {
 
@@ -16,7 +23,8 @@ Experiment::Experiment() : name_("experiment"), number_of_runs_(0)
 }
 
 Experiment::Experiment(const Experiment& rhs) :
-    name_(rhs.name_), number_of_runs_(rhs.number_of_runs_)
+    name_(rhs.name_), number_of_runs_(rhs.number_of_runs_),
+    determinism_check_(rhs.determinism_check_)
 {
     if (rhs.random_) { random_ = rhs.random_->clone(); }
     if (rhs.statistics_) { statistics_ = rhs.statistics_->clone(); }
@@ -33,18 +41,44 @@ void Experiment::setup(const Configuration& config, const PrototypeManager& pm)
 
     name_ = repository_->algorithm_name() + "_" +
             repository_->problem()->name();
+
+    determinism_check_.clear();
+    auto check_config = config.get_config("determinism_check");
+    if (!check_config.is_null()) {
+        auto size = check_config.get_array_size();
+        for (decltype(size) idx = 0; idx < size; ++idx) {
+            determinism_check_.push_back(check_config.get_uint_value(idx));
+        }
+    }
+    if (!determinism_check_.empty() && !repository_->is_deterministic()) {
+        throw std::logic_error("determinism_check requires "
+                               "the deterministic Repository");
+    }
+}
+
+void Experiment::add_label(const std::string& label)
+{
+    if (label.empty()) { return; }
+    repository_->set_algorithm_name(repository_->algorithm_name() + "_" +
+                                    label);
+    name_ = repository_->algorithm_name() + "_" +
+            repository_->problem()->name();
 }
 
 void Experiment::run()
 {
     for (decltype(number_of_runs_) times = 0; times < number_of_runs_; ++times) {
-        // clone a Repository for each run
-        auto repos = repository_->clone();
-        // initialize all evolutionary states
-        repos->init(random_->clone());
-
-        // evolve the evolution
-        repos->evolution()->evolve(repos);
+        auto repos = evolve_run(times, 0);
+        for (auto number_of_threads : determinism_check_) {
+            auto other = evolve_run(times, number_of_threads);
+            if (!is_identical(repos, other)) {
+                std::stringstream ss;
+                ss << name_ << " run " << times+1 << " with "
+                   << number_of_threads << " threads differs from "
+                   << repos->number_of_threads() << " threads";
+                throw std::runtime_error(ss.str());
+            }
+        }
 
         std::stringstream ss;
         ss << name_ << "_run" << times+1;
@@ -55,4 +89,76 @@ void Experiment::run()
     statistics_->output_statistics(name_ + ".csv");
 }
 
+std::shared_ptr<Repository> Experiment::prepare_run(
+                        unsigned int times,
+                        unsigned int number_of_threads) const
+{
+    // clone a Repository for each run
+    auto repos = repository_->clone();
+    if (number_of_threads > 0) {
+        repos->set_number_of_threads(number_of_threads);
+    }
+    // initialize all evolutionary states with the stream of this run
+    repos->init(random_->substream(times));
+    return repos;
+}
+
+std::shared_ptr<Repository> Experiment::evolve_run(
+                        unsigned int times,
+                        unsigned int number_of_threads) const
+{
+    auto repos = prepare_run(times, number_of_threads);
+
+    // evolve the evolution
+    repos->evolution()->evolve(repos);
+    return repos;
+}
+
+bool Experiment::is_identical(std::shared_ptr<const Repository> lhs,
+                              std::shared_ptr<const Repository> rhs) const
+{
+    auto same = [](double lhs, double rhs) {
+        return std::memcmp(&lhs, &rhs, sizeof(double)) == 0;
+    };
+
+    auto lhs_stat = lhs->statistics();
+    auto rhs_stat = rhs->statistics();
+    if (lhs_stat->number_of_fitness_evaluations() !=
+            rhs_stat->number_of_fitness_evaluations() ||
+        lhs_stat->number_of_cache_hits() !=
+            rhs_stat->number_of_cache_hits() ||
+        lhs_stat->number_of_saved_evaluations() !=
+            rhs_stat->number_of_saved_evaluations() ||
+        lhs_stat->best_fitness().size() != rhs_stat->best_fitness().size()) {
+        return false;
+    }
+    for (std::size_t gen = 0; gen < lhs_stat->best_fitness().size(); ++gen) {
+        if (!same(lhs_stat->best_fitness()[gen],
+                  rhs_stat->best_fitness()[gen])) {
+            return false;
+        }
+    }
+
+    auto lhs_pop = lhs->population();
+    auto rhs_pop = rhs->population();
+    if (lhs_pop->population_size() != rhs_pop->population_size()) {
+        return false;
+    }
+    for (std::size_t idx = 0; idx < lhs_pop->population_size(); ++idx) {
+        auto lhs_ind = lhs_pop->at(idx);
+        auto rhs_ind = rhs_pop->at(idx);
+        if (!same(lhs_ind->fitness(), rhs_ind->fitness()) ||
+            lhs_ind->dimension_of_variable() !=
+                rhs_ind->dimension_of_variable()) {
+            return false;
+        }
+        for (std::size_t d = 0; d < lhs_ind->dimension_of_variable(); ++d) {
+            if (!same(lhs_ind->variables(d), rhs_ind->variables(d))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 }
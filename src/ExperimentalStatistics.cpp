@@ -20,6 +20,10 @@ void ExperimentalStatistics::take_statistics(
     fes_.push_back(repos->statistics()->number_of_fitness_evaluations());
     error_.push_back(repos->statistics()->evolve_error(repos));
     best_fitness_.push_back(repos->statistics()->best_fitness_so_far());
+    cache_hits_.push_back(repos->statistics()->number_of_cache_hits());
+    saved_evaluations_.push_back(
+                    repos->statistics()->number_of_saved_evaluations());
+    stop_reasons_.push_back(repos->statistics()->stop_reason());
 }
 
 void ExperimentalStatistics::output_statistics_on_run(
@@ -32,19 +36,30 @@ void ExperimentalStatistics::output_statistics_on_run(
 void ExperimentalStatistics::output_statistics(const std::string& file_name)
 {
     std::ofstream ofs(file_name);
-    ofs << "FEs,Error,best_fitness" << std::endl;
+    ofs << "FEs,Error,best_fitness,cache_hits,saved_evaluations,stop_reason"
+        << std::endl;
 
     auto it_fes = std::begin(fes_);
     auto it_error = std::begin(error_);
     auto it_best_fitness = std::begin(best_fitness_);
+    auto it_cache_hits = std::begin(cache_hits_);
+    auto it_saved = std::begin(saved_evaluations_);
+    auto it_stop_reason = std::begin(stop_reasons_);
     for (;
          it_fes != std::end(fes_) && it_error != std::end(error_) &&
-            it_best_fitness != std::end(best_fitness_);
-         ++it_fes, ++it_error, ++it_best_fitness) {
+            it_best_fitness != std::end(best_fitness_) &&
+            it_cache_hits != std::end(cache_hits_) &&
+            it_saved != std::end(saved_evaluations_) &&
+            it_stop_reason != std::end(stop_reasons_);
+         ++it_fes, ++it_error, ++it_best_fitness, ++it_cache_hits,
+            ++it_saved, ++it_stop_reason) {
 
         ofs << *it_fes << "," <<
                *it_error << "," <<
-               *it_best_fitness << std::endl;
+               *it_best_fitness << "," <<
+               *it_cache_hits << "," <<
+               *it_saved << "," <<
+               *it_stop_reason << std::endl;
     }
 }
 
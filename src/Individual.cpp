@@ -35,9 +35,9 @@ std::shared_ptr<Individual> Individual::empty_clone() const
     return std::make_shared<Individual>(indi);
 }
 
-bool Individual::is_valid(std::shared_ptr<const Problem> problem) const
+bool Individual::is_valid(const Problem& problem) const
 {
-    auto dim_decision_space = problem->dimension_of_decision_space();
+    auto dim_decision_space = problem.dimension_of_decision_space();
     for (decltype(dim_decision_space) dim = 0; dim < dim_decision_space; ++dim) {
         if (is_valid(dim, problem) == false) {
             return false;
@@ -46,11 +46,10 @@ bool Individual::is_valid(std::shared_ptr<const Problem> problem) const
     return true;
 }
 
-bool Individual::is_valid(std::size_t dimension,
-                          std::shared_ptr<const Problem> problem) const
+bool Individual::is_valid(std::size_t dimension, const Problem& problem) const
 {
-    auto lower_bound = problem->lower_bound_of_decision_space(dimension);
-    auto upper_bound = problem->upper_bound_of_decision_space(dimension);
+    auto lower_bound = problem.lower_bound_of_decision_space(dimension);
+    auto upper_bound = problem.upper_bound_of_decision_space(dimension);
     auto value = variables(dimension);
     if (std::islessequal(lower_bound, value) &&
         std::islessequal(value, upper_bound)) {
@@ -61,11 +60,13 @@ bool Individual::is_valid(std::size_t dimension,
     }
 }
 
-void Individual::replace(std::shared_ptr<const Individual> rhs)
+void Individual::replace(const Individual& rhs)
 {
-    variables_ = rhs->variables_;
-    objectives_ = rhs->objectives_;
-    fitness_ = rhs->fitness_;
+    variables_ = rhs.variables_;
+    objectives_ = rhs.objectives_;
+    fitness_ = rhs.fitness_;
+    separable_terms_ = rhs.separable_terms_;
+    separable_sums_ = rhs.separable_sums_;
 }
 
 typename Individual::VariableType& Individual::variables(std::size_t index)
@@ -90,10 +91,9 @@ const typename Individual::ObjectiveType& Individual::objectives(std::size_t ind
 
 Individual& Individual::operator=(const Individual& rhs)
 {
-    Individual temp(rhs);
-    std::swap(variables_, temp.variables_);
-    std::swap(objectives_, temp.objectives_);
-    std::swap(fitness_, temp.fitness_);
+    // the individuals of a population have the same size,
+    // so the assignment reuses the storage without allocations
+    replace(rhs);
     return *this;
 }
 
@@ -1,5 +1,5 @@
 #include <memory>
-#include <functional>
+#include <cstddef>
 #include <random>
 #include "Initializer.h"
 #include "Configuration.h"
@@ -23,20 +23,21 @@ void Initializer::init(std::shared_ptr<Repository> repos)
 
 void Initializer::initialize(std::shared_ptr<Repository> repos) const
 {
-    auto func = std::bind(&Initializer::initialization_function,
-            std::ref(*this), repos->problem(), std::placeholders::_1);
-    repos->population()->apply_to_each_individual(func);
+    auto&& problem = *repos->problem();
+    auto&& pop = *repos->population();
+    for (std::size_t idx = 0; idx < pop.population_size(); ++idx) {
+        initialization_function(problem, pop.individual(idx));
+    }
 }
 
-void Initializer::initialization_function(
-                                  std::shared_ptr<const Problem> problem,
-                                  std::shared_ptr<Individual> individual) const
+void Initializer::initialization_function(const Problem& problem,
+                                          Individual& individual) const
 {
-    for (unsigned int idx = 0; idx < problem->dimension_of_decision_space(); ++idx) {
+    for (unsigned int idx = 0; idx < problem.dimension_of_decision_space(); ++idx) {
         std::uniform_real_distribution<> uniform(
-                                 problem->lower_bound_of_decision_space(idx),
-                                 problem->upper_bound_of_decision_space(idx));
-        individual->variables(idx) = random_->generate(uniform);
+                                 problem.lower_bound_of_decision_space(idx),
+                                 problem.upper_bound_of_decision_space(idx));
+        individual.variables(idx) = random_->generate(uniform);
     }
 }
 
@@ -0,0 +1,319 @@
+#include <memory>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <exception>
+#include <stdexcept>
+#include <numeric>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include "IslandEvolution.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+#include "Repository.h"
+#include "Population.h"
+#include "Individual.h"
+#include "Statistics.h"
+#include "Random.h"
+
+namespace adef {
+
+void IslandEvolution::setup(const Configuration& config,
+                            const PrototypeManager& pm)
+{
+    Evolution::setup(config, pm);
+
+    number_of_islands_ = config.get_uint_value("number_of_islands");
+    migration_interval_ = config.get_uint_value("migration_interval");
+    number_of_migrants_ = config.get_uint_value("number_of_migrants");
+    if (number_of_islands_ == 0 || migration_interval_ == 0) {
+        throw std::logic_error("IslandEvolution requires at least one island \
+and the positive migration interval");
+    }
+
+    auto topology_config = config.get_config("topology");
+    topology_ = topology_config.is_null() ?
+                    "ring" : topology_config.get_string_value();
+
+    neighbors_.clear();
+    neighbors_.resize(number_of_islands_);
+    if (number_of_islands_ == 1) {
+        return;
+    }
+
+    if (topology_ == "ring") {
+        for (std::size_t idx = 0; idx < number_of_islands_; ++idx) {
+            neighbors_[idx].push_back((idx + 1) % number_of_islands_);
+        }
+    }
+    else if (topology_ == "torus") {
+        unsigned int columns = static_cast<unsigned int>(
+                                    std::sqrt(number_of_islands_));
+        while (number_of_islands_ % columns != 0) { --columns; }
+        auto columns_config = config.get_config("number_of_columns");
+        columns = columns_config.is_null() ?
+                    columns : columns_config.get_uint_value();
+        if (columns == 0 || number_of_islands_ % columns != 0) {
+            throw std::logic_error("The number of islands must be divisible \
+by the number of columns in IslandEvolution");
+        }
+        auto rows = number_of_islands_ / columns;
+        for (std::size_t idx = 0; idx < number_of_islands_; ++idx) {
+            auto row = idx / columns;
+            auto column = idx % columns;
+            auto right = row * columns + (column + 1) % columns;
+            auto lower = ((row + 1) % rows) * columns + column;
+            for (auto neighbor : {right, lower}) {
+                auto& neighbors = neighbors_[idx];
+                if (neighbor != idx &&
+                    std::find(neighbors.begin(), neighbors.end(), neighbor) ==
+                        neighbors.end()) {
+                    neighbors.push_back(neighbor);
+                }
+            }
+        }
+    }
+    else {
+        throw std::logic_error("Unknown topology \"" + topology_ +
+                               "\" in IslandEvolution");
+    }
+}
+
+void IslandEvolution::evolve(std::shared_ptr<Repository> repos) const
+{
+    // the islands share the budget of FEs, so it is never overshot
+    auto budget = repos->statistics()->max_fitness_evaluations();
+    if (budget > 0 && budget < number_of_islands_) {
+        throw std::logic_error("The budget of FEs is less than the number \
+of islands in IslandEvolution");
+    }
+
+    // each island has its own states and random generator
+    std::vector<std::shared_ptr<Repository>> islands;
+    for (std::size_t idx = 0; idx < number_of_islands_; ++idx) {
+        auto island = repos->clone();
+        island->init(repos->random()->substream(idx));
+        if (budget > 0) {
+            auto share = budget / number_of_islands_ +
+                         (idx < budget % number_of_islands_ ? 1 : 0);
+            island->statistics()->set_max_fitness_evaluations(share);
+        }
+        islands.push_back(island);
+    }
+
+    // one queue for each directed edge of the topology
+    std::vector<std::unique_ptr<MigrationQueue>> queues;
+    std::vector<std::vector<MigrationQueue*>> outgoing(number_of_islands_);
+    std::vector<std::vector<MigrationQueue*>> incoming(number_of_islands_);
+    auto capacity = 2 * std::max(number_of_migrants_, 1u);
+    for (std::size_t from = 0; from < number_of_islands_; ++from) {
+        for (auto to : neighbors_[from]) {
+            queues.push_back(std::make_unique<MigrationQueue>(capacity));
+            outgoing[from].push_back(queues.back().get());
+            incoming[to].push_back(queues.back().get());
+        }
+    }
+
+    if (repos->is_deterministic()) {
+        evolve_synchronously(islands, outgoing, incoming);
+    }
+    else {
+        std::atomic<bool> terminated(false);
+        run_islands([&](std::size_t idx) {
+            try {
+                evolve_island(islands[idx], outgoing[idx], incoming[idx],
+                              terminated);
+            }
+            catch (...) {
+                terminated = true;
+                throw;
+            }
+        });
+    }
+
+    // gather the results of islands
+    std::size_t best_island = 0;
+    std::string stop_reason;
+    std::size_t stagnant_islands = 0;
+    for (std::size_t idx = 0; idx < number_of_islands_; ++idx) {
+        record_stop_reason(islands[idx]);
+        auto statistics = islands[idx]->statistics();
+        repos->statistics()->merge(*statistics);
+        // the island which stops the others
+        auto reason = statistics->stop_reason();
+        if (reason == "stagnation") { ++stagnant_islands; }
+        else if (reason != "max_generation" && stop_reason.empty()) {
+            stop_reason = reason;
+        }
+        if (statistics->best_fitness_so_far() <
+            islands[best_island]->statistics()->best_fitness_so_far()) {
+            best_island = idx;
+        }
+    }
+    if (stop_reason.empty()) {
+        stop_reason = stagnant_islands == number_of_islands_ ?
+                        "stagnation" : "max_generation";
+    }
+    repos->population()->replace(islands[best_island]->population());
+    repos->statistics()->set_stop_reason(stop_reason);
+}
+
+void IslandEvolution::evolve_island(
+                            std::shared_ptr<Repository> island,
+                            const std::vector<MigrationQueue*>& outgoing,
+                            const std::vector<MigrationQueue*>& incoming,
+                            std::atomic<bool>& terminated) const
+{
+    initialize_evolution(island);
+
+    // for each generation
+    unsigned int gen = 1;
+    while (gen <= max_generation_ && !terminated) {
+        auto reason = island->statistics()->termination_reason(island);
+        if (!reason.empty()) {
+            if (stops_all_islands(reason)) { terminated = true; }
+            break;
+        }
+
+        evolve_generation(island, gen);
+
+        if (gen % migration_interval_ == 0) {
+            emigrate(island, outgoing);
+            immigrate(island, incoming);
+        }
+        // increase generation
+        ++gen;
+    }
+}
+
+void IslandEvolution::evolve_synchronously(
+        const std::vector<std::shared_ptr<Repository>>& islands,
+        const std::vector<std::vector<MigrationQueue*>>& outgoing,
+        const std::vector<std::vector<MigrationQueue*>>& incoming) const
+{
+    // an island is stopped by itself, and all islands are terminated
+    // by any of them
+    std::vector<char> stopped(number_of_islands_, false);
+    std::vector<char> terminated(number_of_islands_, false);
+    run_islands([&](std::size_t idx) {
+        initialize_evolution(islands[idx]);
+    });
+
+    // islands evolve in parallel between two migrations and
+    // exchange migrants in the order of islands
+    unsigned int first = 1;
+    while (first <= max_generation_) {
+        auto last = std::min(first + migration_interval_ - 1, max_generation_);
+        run_islands([&](std::size_t idx) {
+            for (auto gen = first; gen <= last && !stopped[idx]; ++gen) {
+                auto reason = islands[idx]->statistics()->termination_reason(
+                                                                islands[idx]);
+                if (!reason.empty()) {
+                    stopped[idx] = true;
+                    terminated[idx] = stops_all_islands(reason);
+                    break;
+                }
+                evolve_generation(islands[idx], gen);
+            }
+        });
+        if (std::find(terminated.begin(), terminated.end(), true) !=
+                terminated.end() ||
+            std::find(stopped.begin(), stopped.end(), false) ==
+                stopped.end() ||
+            last % migration_interval_ != 0) {
+            break;
+        }
+
+        for (std::size_t idx = 0; idx < number_of_islands_; ++idx) {
+            if (!stopped[idx]) { emigrate(islands[idx], outgoing[idx]); }
+        }
+        for (std::size_t idx = 0; idx < number_of_islands_; ++idx) {
+            if (!stopped[idx]) { immigrate(islands[idx], incoming[idx]); }
+        }
+        first = last + 1;
+    }
+}
+
+bool IslandEvolution::stops_all_islands(const std::string& reason) const
+{
+    // the other islands may still improve
+    return reason != "stagnation";
+}
+
+void IslandEvolution::run_islands(
+                    const std::function<void(std::size_t)>& func) const
+{
+    std::vector<std::exception_ptr> errors(number_of_islands_);
+    auto run_island = [&](std::size_t idx) {
+        try {
+            func(idx);
+        }
+        catch (...) {
+            errors[idx] = std::current_exception();
+        }
+    };
+
+    // the calling thread runs the first island
+    std::vector<std::thread> threads;
+    for (std::size_t idx = 1; idx < number_of_islands_; ++idx) {
+        threads.emplace_back(run_island, idx);
+    }
+    run_island(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) { std::rethrow_exception(error); }
+    }
+}
+
+void IslandEvolution::emigrate(
+                        std::shared_ptr<const Repository> island,
+                        const std::vector<MigrationQueue*>& outgoing) const
+{
+    auto pop = island->population();
+    std::vector<std::size_t> indexes(pop->population_size());
+    std::iota(indexes.begin(), indexes.end(), 0);
+
+    auto migrants = std::min<std::size_t>(number_of_migrants_, indexes.size());
+    std::partial_sort(indexes.begin(), indexes.begin() + migrants,
+                      indexes.end(),
+                      [&pop](std::size_t lhs, std::size_t rhs) {
+                          return pop->at(lhs)->fitness() <
+                                 pop->at(rhs)->fitness();
+                      });
+
+    for (auto queue : outgoing) {
+        for (std::size_t idx = 0; idx < migrants; ++idx) {
+            // drop the migrant if the neighbor lags behind
+            if (!queue->push(pop->at(indexes[idx])->clone())) { break; }
+        }
+    }
+}
+
+void IslandEvolution::immigrate(
+                        std::shared_ptr<Repository> island,
+                        const std::vector<MigrationQueue*>& incoming) const
+{
+    auto pop = island->population();
+    auto pop_size = pop->population_size();
+    std::shared_ptr<Individual> immigrant;
+    for (auto queue : incoming) {
+        while (queue->pop(immigrant)) {
+            std::size_t worst = 0;
+            for (std::size_t idx = 1; idx < pop_size; ++idx) {
+                if (pop->at(idx)->fitness() > pop->at(worst)->fitness()) {
+                    worst = idx;
+                }
+            }
+            if (immigrant->fitness() < pop->at(worst)->fitness()) {
+                *pop->at(worst) = *immigrant;
+            }
+        }
+    }
+}
+
+}
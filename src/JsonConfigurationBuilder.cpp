@@ -1,8 +1,15 @@
 #include <memory>
 #include <istream>
 #include <string>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <exception>
+#include <stdexcept>
 #include <iostream>
+#include <sstream>
 #include "JsonConfigurationBuilder.h"
 #include "JsonConfigurationData.h"
 #include "json.hpp"
@@ -11,6 +18,186 @@ using json = nlohmann::json;
 
 namespace adef {
 
+namespace {
+
+/// The dimension of the cross product of sweeps.
+struct SweepAxis {
+
+    std::string name;                     ///< The name, empty if unnamed.
+    std::size_t size;                     ///< The number of values.
+    std::vector<const json*> sweeps;      ///< The sweeps on the dimension.
+    std::vector<std::string> keys;        ///< The member names of the sweeps.
+};
+
+bool is_sweep(const json& node)
+{
+    return node.is_object() &&
+           (node.find("$sweep") != node.end() ||
+            node.find("$range") != node.end());
+}
+
+/**
+Return the number of values of the range [start, stop, step].
+*/
+std::size_t range_size(const json& range)
+{
+    if (!range.is_array() || range.size() < 2 || range.size() > 3) {
+        throw std::domain_error("$range should be [start, stop, step].");
+    }
+    for (auto&& number : range) {
+        if (!number.is_number()) {
+            throw std::domain_error("$range should consist of numbers.");
+        }
+    }
+    auto start = range[0].get<double>();
+    auto stop = range[1].get<double>();
+    auto step = range.size() == 3 ? range[2].get<double>() : 1.0;
+    if (!(step > 0)) {
+        throw std::domain_error("The step of $range should be positive.");
+    }
+    if (stop < start) {
+        throw std::domain_error("The stop of $range should not be less "
+                                "than the start.");
+    }
+    // tolerate the rounding error of the floating-point step
+    return static_cast<std::size_t>(
+                std::floor((stop - start) / step + 1e-9)) + 1;
+}
+
+std::size_t sweep_size(const json& sweep)
+{
+    auto values = sweep.find("$sweep");
+    if (values != sweep.end()) {
+        if (!values->is_array() || values->empty()) {
+            throw std::domain_error("$sweep should be a non-empty array.");
+        }
+        return values->size();
+    }
+    return range_size(sweep["$range"]);
+}
+
+json sweep_value(const json& sweep, std::size_t idx)
+{
+    auto values = sweep.find("$sweep");
+    if (values != sweep.end()) {
+        return (*values)[idx];
+    }
+    auto&& range = sweep["$range"];
+    bool is_integer = true;
+    for (auto&& number : range) {
+        is_integer = is_integer && number.is_number_integer();
+    }
+    if (is_integer) {
+        auto step = range.size() == 3 ? range[2].get<long long>() : 1;
+        return range[0].get<long long>() +
+               static_cast<long long>(idx) * step;
+    }
+    auto step = range.size() == 3 ? range[2].get<double>() : 1.0;
+    return range[0].get<double>() + idx * step;
+}
+
+/**
+Collect the sweeps in @a node in the order of the document.
+@a key is the name of the member which contains @a node.
+*/
+void collect_sweeps(const json& node, const std::string& key,
+                    std::vector<SweepAxis>& axes)
+{
+    if (is_sweep(node)) {
+        auto size = sweep_size(node);
+        std::string name;
+        auto axis_name = node.find("$axis");
+        if (axis_name != node.end()) {
+            if (!axis_name->is_string()) {
+                throw std::domain_error("$axis should be a string.");
+            }
+            name = axis_name->get<std::string>();
+        }
+        for (auto&& axis : axes) {
+            if (!name.empty() && axis.name == name) {
+                if (axis.size != size) {
+                    throw std::domain_error("The sweeps of $axis " + name +
+                                            " should have the same size.");
+                }
+                axis.sweeps.push_back(&node);
+                axis.keys.push_back(key);
+                return;
+            }
+        }
+        axes.push_back({ name, size, { &node }, { key } });
+    }
+    else if (node.is_object()) {
+        for (auto it = node.begin(); it != node.end(); ++it) {
+            collect_sweeps(it.value(), it.key(), axes);
+        }
+    }
+    else if (node.is_array()) {
+        for (auto&& child : node) {
+            collect_sweeps(child, key, axes);
+        }
+    }
+}
+
+/**
+Return the index of the value of each axis in the combination of @a index.
+*/
+std::vector<std::size_t> combination_indexes(
+                            const std::vector<SweepAxis>& axes,
+                            unsigned int index)
+{
+    // the last axis changes fastest
+    std::vector<std::size_t> indexes(axes.size());
+    for (auto idx = axes.size(); idx > 0; --idx) {
+        indexes[idx-1] = index % axes[idx-1].size;
+        index /= axes[idx-1].size;
+    }
+    return indexes;
+}
+
+/**
+Return the text of the scalar value, or empty for the structured value.
+*/
+std::string label_of(const json& value)
+{
+    if (value.is_string()) { return value.get<std::string>(); }
+    if (value.is_number_float()) {
+        // 6 significant digits hide the rounding error of $range
+        std::ostringstream oss;
+        oss << value.get<double>();
+        return oss.str();
+    }
+    if (value.is_number() || value.is_boolean()) { return value.dump(); }
+    return std::string();
+}
+
+/**
+Return the copy of @a node whose sweeps are replaced by @a values.
+*/
+json expand_sweeps(const json& node, const std::map<const json*, json>& values)
+{
+    auto value = values.find(&node);
+    if (value != values.end()) {
+        return value->second;
+    }
+    if (node.is_object()) {
+        auto result = json::object();
+        for (auto it = node.begin(); it != node.end(); ++it) {
+            result[it.key()] = expand_sweeps(it.value(), values);
+        }
+        return result;
+    }
+    if (node.is_array()) {
+        auto result = json::array();
+        for (auto&& child : node) {
+            result.push_back(expand_sweeps(child, values));
+        }
+        return result;
+    }
+    return node;
+}
+
+}
+
 bool JsonConfigurationBuilder::load_config(
                    std::istream& is,
                    std::shared_ptr<ConfigurationData> config_data) const
@@ -18,7 +205,7 @@ bool JsonConfigurationBuilder::load_config(
     auto json_config_data =
                 std::dynamic_pointer_cast<JsonConfigurationData>(config_data);
     try {
-        json_config_data->data = json::parse(is);
+        json_config_data->reset(json::parse(is));
         return true;
     }
     catch (const std::exception& e) {
@@ -37,7 +224,7 @@ bool JsonConfigurationBuilder::is_object(
     if (config_data) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-        return json_config_data->data.is_object();
+        return json_config_data->data().is_object();
     }
     return false;
 }
@@ -48,7 +235,7 @@ bool JsonConfigurationBuilder::is_array(
     if (config_data) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-        return json_config_data->data.is_array();
+        return json_config_data->data().is_array();
     }
     return false;
 }
@@ -59,7 +246,7 @@ bool JsonConfigurationBuilder::is_null(
     if (config_data) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-        return json_config_data->data.is_null();
+        return json_config_data->data().is_null();
     }
     return false;
 }
@@ -70,7 +257,7 @@ bool JsonConfigurationBuilder::is_boolean(
     if (config_data) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-        return json_config_data->data.is_boolean();
+        return json_config_data->data().is_boolean();
     }
     return false;
 }
@@ -81,7 +268,7 @@ bool JsonConfigurationBuilder::is_string(
     if (config_data) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-        return json_config_data->data.is_string();
+        return json_config_data->data().is_string();
     }
     return false;
 }
@@ -92,7 +279,7 @@ bool JsonConfigurationBuilder::is_number(
     if (config_data) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-        return json_config_data->data.is_number();
+        return json_config_data->data().is_number();
     }
     return false;
 }
@@ -103,7 +290,7 @@ bool JsonConfigurationBuilder::is_number_integer(
     if (config_data) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-        return json_config_data->data.is_number_integer();
+        return json_config_data->data().is_number_integer();
     }
     return false;
 }
@@ -114,7 +301,7 @@ bool JsonConfigurationBuilder::is_number_floating_point(
     if (config_data) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-        return json_config_data->data.is_number_float();
+        return json_config_data->data().is_number_float();
     }
     return false;
 }
@@ -130,11 +317,10 @@ std::shared_ptr<ConfigurationData> JsonConfigurationBuilder::get_config_data(
     if (is_object(config_data)) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-        if (json_config_data->data.find(member_name) !=
-                                            json_config_data->data.end()) {
-            JsonConfigurationData new_config_data;
-            new_config_data.data = json_config_data->data[member_name];
-            return std::make_shared<JsonConfigurationData>(new_config_data);
+        auto&& data = json_config_data->data();
+        auto member = data.find(member_name);
+        if (member != data.end()) {
+            return json_config_data->view(&*member);
         }
     }
     return std::make_shared<JsonConfigurationData>();
@@ -150,7 +336,7 @@ unsigned int JsonConfigurationBuilder::get_array_size(
     if (is_array(config_data)) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-        return json_config_data->data.size();
+        return json_config_data->data().size();
     }
     return 0;
 }
@@ -162,14 +348,93 @@ std::shared_ptr<ConfigurationData> JsonConfigurationBuilder::get_config_data(
     if ((is_array(config_data)) && (index < get_array_size(config_data))) {
         auto json_config_data =
             std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-
-        JsonConfigurationData new_config_data;
-        new_config_data.data = json_config_data->data[index];
-        return std::make_shared<JsonConfigurationData>(new_config_data);
+        return json_config_data->view(&json_config_data->data()[index]);
     }
     return std::make_shared<JsonConfigurationData>();
 }
 
+/*
+    for Sweep
+*/
+
+unsigned int JsonConfigurationBuilder::get_sweep_size(
+            std::shared_ptr<const ConfigurationData> config_data) const
+{
+    if (!config_data) { return 1; }
+    auto json_config_data =
+        std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
+
+    std::vector<SweepAxis> axes;
+    collect_sweeps(json_config_data->data(), std::string(), axes);
+    unsigned long long size = 1;
+    for (auto&& axis : axes) {
+        size *= axis.size;
+        if (size > std::numeric_limits<unsigned int>::max()) {
+            throw std::domain_error("The number of combinations of sweeps "
+                                    "is too large.");
+        }
+    }
+    return static_cast<unsigned int>(size);
+}
+
+std::shared_ptr<ConfigurationData>
+JsonConfigurationBuilder::get_sweep_config_data(
+                    unsigned int index,
+                    std::shared_ptr<const ConfigurationData> config_data) const
+{
+    if (index >= get_sweep_size(config_data)) {
+        throw std::out_of_range("The index of sweeps is out of range.");
+    }
+    auto json_config_data =
+        std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
+    auto&& data = json_config_data->data();
+
+    std::vector<SweepAxis> axes;
+    collect_sweeps(data, std::string(), axes);
+    if (axes.empty()) {
+        return json_config_data->view(&data);
+    }
+
+    auto indexes = combination_indexes(axes, index);
+    std::map<const json*, json> values;
+    for (std::size_t idx = 0; idx < axes.size(); ++idx) {
+        for (auto sweep : axes[idx].sweeps) {
+            values[sweep] = sweep_value(*sweep, indexes[idx]);
+        }
+    }
+    auto new_config_data = std::make_shared<JsonConfigurationData>();
+    new_config_data->reset(expand_sweeps(data, values));
+    return new_config_data;
+}
+
+std::string JsonConfigurationBuilder::get_sweep_label(
+                    unsigned int index,
+                    std::shared_ptr<const ConfigurationData> config_data) const
+{
+    if (index >= get_sweep_size(config_data)) {
+        throw std::out_of_range("The index of sweeps is out of range.");
+    }
+    if (!config_data) { return std::string(); }
+    auto json_config_data =
+        std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
+
+    std::vector<SweepAxis> axes;
+    collect_sweeps(json_config_data->data(), std::string(), axes);
+
+    auto indexes = combination_indexes(axes, index);
+    std::string label;
+    for (std::size_t idx = 0; idx < axes.size(); ++idx) {
+        for (std::size_t sweep = 0; sweep < axes[idx].sweeps.size(); ++sweep) {
+            auto value = label_of(sweep_value(*axes[idx].sweeps[sweep],
+                                              indexes[idx]));
+            if (value.empty()) { continue; }
+            if (!label.empty()) { label += "_"; }
+            label += axes[idx].keys[sweep] + value;
+        }
+    }
+    return label;
+}
+
 /*
     for Value
 */
@@ -182,7 +447,7 @@ bool JsonConfigurationBuilder::get_bool_value(
     }
     auto json_config_data =
         std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-    return json_config_data->data.get<bool>();
+    return json_config_data->data().get<bool>();
 }
 
 std::string JsonConfigurationBuilder::get_string_value(
@@ -193,7 +458,7 @@ std::string JsonConfigurationBuilder::get_string_value(
     }
     auto json_config_data =
         std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-    return json_config_data->data.get<std::string>();
+    return json_config_data->data().get<std::string>();
 }
 
 int JsonConfigurationBuilder::get_int_value(
@@ -204,7 +469,7 @@ int JsonConfigurationBuilder::get_int_value(
     }
     auto json_config_data =
         std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-    return json_config_data->data.get<int>();
+    return json_config_data->data().get<int>();
 }
 
 unsigned int JsonConfigurationBuilder::get_uint_value(
@@ -215,7 +480,7 @@ unsigned int JsonConfigurationBuilder::get_uint_value(
     }
     auto json_config_data =
         std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-    return json_config_data->data.get<unsigned int>();
+    return json_config_data->data().get<unsigned int>();
 }
 
 double JsonConfigurationBuilder::get_double_value(
@@ -226,7 +491,7 @@ double JsonConfigurationBuilder::get_double_value(
     }
     auto json_config_data =
         std::dynamic_pointer_cast<const JsonConfigurationData>(config_data);
-    return json_config_data->data.get<double>();
+    return json_config_data->data().get<double>();
 }
 
 }
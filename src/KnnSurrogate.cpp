@@ -0,0 +1,67 @@
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+#include "KnnSurrogate.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+#include "Repository.h"
+#include "Problem.h"
+#include "Individual.h"
+
+namespace adef {
+
+void KnnSurrogate::setup(const Configuration& config, const PrototypeManager& pm)
+{
+    Surrogate::setup(config, pm);
+
+    auto neighbors_config = config.get_config("number_of_neighbors");
+    number_of_neighbors_ = neighbors_config.is_null() ?
+                            5 : neighbors_config.get_uint_value();
+
+    auto archive_config = config.get_config("archive_size");
+    archive_size_ = archive_config.is_null() ?
+                        1000 : archive_config.get_uint_value();
+
+    if (number_of_neighbors_ == 0 || archive_size_ < number_of_neighbors_) {
+        throw std::logic_error("KnnSurrogate requires at least one neighbor \
+and the archive larger than the number of neighbors");
+    }
+}
+
+void KnnSurrogate::init(std::shared_ptr<Repository> repos)
+{
+    archive_.clear(repos->problem()->dimension_of_decision_space());
+    neighbors_.reserve(number_of_neighbors_);
+}
+
+void KnnSurrogate::learn(const Individual& individual)
+{
+    if (archive_.size() >= archive_size_) {
+        archive_.erase_oldest(std::max<std::size_t>(archive_size_ / 2, 1));
+    }
+    archive_.insert(individual.variable_data(), individual.fitness());
+}
+
+bool KnnSurrogate::predict(const Individual& individual, double& fitness) const
+{
+    if (archive_.size() < number_of_neighbors_) { return false; }
+
+    archive_.nearest(individual.variable_data(), number_of_neighbors_,
+                     neighbors_);
+    if (neighbors_.front().distance == 0) {
+        fitness = archive_.value(neighbors_.front().index);
+        return true;
+    }
+    double sum = 0, weights = 0;
+    for (auto&& neighbor : neighbors_) {
+        auto weight = 1.0 / neighbor.distance;
+        sum += weight * archive_.value(neighbor.index);
+        weights += weight;
+    }
+    fitness = sum / weights;
+    return true;
+}
+
+}
@@ -0,0 +1,66 @@
+#include <memory>
+#include <string>
+#include <stdexcept>
+#include "PluginLoader.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+#include "problem/plugin/PluginProblem.h"
+#ifdef ADEF_HAS_PLUGIN
+#include <dlfcn.h>
+#endif
+
+namespace adef {
+
+void load_plugins(const Configuration& config, PrototypeManager& pm)
+{
+    auto plugins_config = config.get_config("plugins");
+    if (plugins_config.is_null()) { return; }
+
+    if (!plugins_config.is_array()) {
+        load_plugin(plugins_config.get_string_value(), pm);
+        return;
+    }
+    for (unsigned int idx = 0; idx < plugins_config.get_array_size(); ++idx) {
+        load_plugin(plugins_config.get_string_value(idx), pm);
+    }
+}
+
+void load_plugin(const std::string& path, PrototypeManager& pm)
+{
+#ifdef ADEF_HAS_PLUGIN
+    // the global symbols let the C++ plugins share the types of ADEF
+    auto handle = dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    if (!handle) {
+        throw std::runtime_error("Load error on plugin: " + path + ": " +
+                                 dlerror());
+    }
+
+    // the plugin without the entry point has only C++ prototypes
+    auto symbol = dlsym(handle, ADEF_PLUGIN_ENTRY_NAME);
+    if (!symbol) { return; }
+    auto entry = reinterpret_cast<adef_plugin_entry_function>(symbol);
+    auto plugin = entry();
+    if (!plugin || plugin->abi_version != ADEF_PLUGIN_ABI_VERSION) {
+        throw std::runtime_error("The plugin " + path +
+                                 " has the different ABI version.");
+    }
+
+    for (unsigned int idx = 0; idx < plugin->number_of_problems; ++idx) {
+        auto descriptor = &plugin->problems[idx];
+        if (!descriptor->classname || !descriptor->evaluate) {
+            throw std::runtime_error("The plugin " + path +
+                                     " has the problem without the "
+                                     "classname or the evaluation.");
+        }
+        pm.register_type(descriptor->classname,
+                         [descriptor]() -> std::shared_ptr<Prototype> {
+                             return std::make_shared<PluginProblem>(descriptor);
+                         });
+    }
+#else
+    throw std::runtime_error("Load error on plugin: " + path +
+                             ": the plugins are not supported.");
+#endif
+}
+
+}
@@ -55,6 +55,14 @@ void Population::apply_to_each_individual(
     std::for_each(individuals_.begin(), individuals_.end(), func);
 }
 
+void Population::share(Population& rhs, const std::vector<std::size_t>& indexes)
+{
+    individuals_.resize(indexes.size());
+    for (std::size_t idx = 0; idx < indexes.size(); ++idx) {
+        individuals_[idx] = rhs.individuals_.at(indexes[idx]);
+    }
+}
+
 void Population::replace(std::shared_ptr<const Population> rhs)
 {
     auto pop_size = individuals_.size();
@@ -68,7 +76,7 @@ void Population::replace(std::shared_ptr<const Population> rhs)
     }
 }
 
-std::shared_ptr<Individual> Population::at(std::size_t index)
+const std::shared_ptr<Individual>& Population::at(std::size_t index)
 {
     return individuals_.at(index);
 }
@@ -78,7 +86,7 @@ std::shared_ptr<const Individual> Population::at(std::size_t index) const
     return individuals_.at(index);
 }
 
-std::shared_ptr<Individual> Population::operator[](std::size_t index)
+const std::shared_ptr<Individual>& Population::operator[](std::size_t index)
 {
     return individuals_[index];
 }
@@ -1,6 +1,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <cmath>
 #include <cstddef>
 #include <stdexcept>
 #include "Problem.h"
@@ -65,14 +66,112 @@ void Problem::setup(const Configuration& config, const PrototypeManager& pm)
 
 void Problem::init(std::shared_ptr<Repository> repos)
 {
-    random_ = repos->random();
+    if (!is_shareable()) { random_ = repos->random(); }
 }
 
-void Problem::evaluate(std::shared_ptr<Individual> individual) const
+void Problem::evaluate(Individual& individual) const
 {
     evaluation_function(individual);
 }
 
+void Problem::evaluate_batch(const std::vector<Individual*>& individuals) const
+{
+    for (auto individual : individuals) {
+        evaluate(*individual);
+    }
+}
+
+void Problem::separable_terms(Object variable, std::size_t dimension,
+                              Object* terms) const
+{
+    throw std::logic_error("The Problem \"" + name() + "\" is not separable.");
+}
+
+void Problem::separable_objectives(const Object* sums,
+                                   Individual& individual) const
+{
+    throw std::logic_error("The Problem \"" + name() + "\" is not separable.");
+}
+
+void Problem::evaluate_separably(Individual& individual) const
+{
+    auto number_of_sums = number_of_separable_sums();
+    if (number_of_sums == 0) {
+        throw std::logic_error("The Problem \"" + name() + "\" is not separable.");
+    }
+    auto size = individual.dimension_of_variable();
+    auto&& terms = individual.separable_terms();
+    auto&& sums = individual.separable_sums();
+    terms.resize(size * number_of_sums);
+    sums.assign(number_of_sums * 2, 0);
+    auto magnitudes = sums.data() + number_of_sums;
+
+    // the sums are added in the order of dimensions like evaluate()
+    auto variables = individual.variable_data();
+    for (std::size_t dim = 0; dim < size; ++dim) {
+        auto term = terms.data() + dim * number_of_sums;
+        separable_terms(variables[dim], dim, term);
+        for (std::size_t idx = 0; idx < number_of_sums; ++idx) {
+            sums[idx] += term[idx];
+            magnitudes[idx] += std::fabs(term[idx]);
+        }
+    }
+    separable_objectives(sums.data(), individual);
+}
+
+void Problem::evaluate_partially(
+                        Individual& individual,
+                        const Individual& target,
+                        const std::vector<std::size_t>& changed_indexes) const
+{
+    if (!has_separable_terms(target) ||
+        target.dimension_of_variable() != individual.dimension_of_variable()) {
+        throw std::logic_error("The target has no terms of the Problem \"" +
+                               name() + "\".");
+    }
+    auto number_of_sums = number_of_separable_sums();
+    auto&& terms = individual.separable_terms();
+    auto&& sums = individual.separable_sums();
+    terms = target.separable_terms();
+    sums = target.separable_sums();
+    auto magnitudes = sums.data() + number_of_sums;
+
+    auto variables = individual.variable_data();
+    for (auto dim : changed_indexes) {
+        auto term = terms.data() + dim * number_of_sums;
+        for (std::size_t idx = 0; idx < number_of_sums; ++idx) {
+            sums[idx] -= term[idx];
+            magnitudes[idx] += std::fabs(term[idx]);
+        }
+        separable_terms(variables[dim], dim, term);
+        for (std::size_t idx = 0; idx < number_of_sums; ++idx) {
+            sums[idx] += term[idx];
+            magnitudes[idx] += std::fabs(term[idx]);
+        }
+    }
+
+    // the rounding error of a sum is about epsilon times its magnitude,
+    // so the sum which becomes much smaller than its magnitude, e.g.,
+    // near the optimum, is computed from scratch again
+    auto size = individual.dimension_of_variable();
+    for (std::size_t idx = 0; idx < number_of_sums; ++idx) {
+        if (magnitudes[idx] > size * std::fabs(sums[idx])) {
+            evaluate_separably(individual);
+            return;
+        }
+    }
+    separable_objectives(sums.data(), individual);
+}
+
+bool Problem::has_separable_terms(const Individual& individual) const
+{
+    auto number_of_sums = number_of_separable_sums();
+    return number_of_sums > 0 &&
+           individual.separable_sums().size() == number_of_sums * 2 &&
+           individual.separable_terms().size() ==
+                individual.dimension_of_variable() * number_of_sums;
+}
+
 Problem::Object Problem::lower_bound_of_decision_space(std::size_t dimension) const
 {
     return boundaries_of_decision_space_.at(dimension).lower_bound_;
@@ -1,6 +1,8 @@
-#include <map>
+#include <unordered_map>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include <stdexcept>
 #include "PrototypeManager.h"
 #include "Prototype.h"
@@ -8,17 +10,61 @@
 
 namespace adef {
 
+namespace {
+
+/**
+The types registered to all managers, which may be registered by
+the shared libraries loaded at run time.
+*/
+struct GlobalTypes {
+
+    std::mutex mutex;
+    std::unordered_map<std::string, PrototypeManager::Factory> table;
+};
+
+GlobalTypes& global_types()
+{
+    static GlobalTypes types;
+    return types;
+}
+
+}
+
 void PrototypeManager::register_type(const std::string& name,
                                      std::shared_ptr<Prototype> type)
 {
-    table_of_type_[name] = type->clone();
+    std::shared_ptr<const Prototype> prototype = type->clone();
+    table_of_type_[name] = [prototype] { return prototype->clone(); };
+}
+
+void PrototypeManager::register_type(const std::string& name, Factory factory)
+{
+    table_of_type_[name] = std::move(factory);
+}
+
+void PrototypeManager::register_global_type(const std::string& name,
+                                            Factory factory)
+{
+    auto&& types = global_types();
+    std::lock_guard<std::mutex> lock(types.mutex);
+    types.table[name] = std::move(factory);
 }
 
 std::shared_ptr<Prototype> PrototypeManager::make_type(const std::string& name) const
 {
     auto it = table_of_type_.find(name);
     if (it != table_of_type_.end()) {
-        return it->second->clone();
+        return it->second();
+    }
+    Factory factory;
+    {
+        auto&& types = global_types();
+        std::lock_guard<std::mutex> lock(types.mutex);
+        auto global = types.table.find(name);
+        if (global != types.table.end()) { factory = global->second; }
+    }
+    if (factory) {
+        return factory();
     }
     throw std::logic_error("PrototypeManager does not find the type: " + name);
     return nullptr;
@@ -1,4 +1,5 @@
 #include <cstdlib>
+#include <vector>
 #include "Random.h"
 #include "Repository.h"
 #include "Configuration.h"
@@ -10,6 +11,10 @@ Random::Random() : seed_(0)
 {
 }
 
+Random::Random(unsigned int seed) : seed_(seed), generator_(seed)
+{
+}
+
 Random::Random(const Random& rhs) : seed_(rhs.seed_), generator_(rhs.seed_)
 {
 }
@@ -18,13 +23,29 @@ void Random::setup(const Configuration& config, const PrototypeManager& pm)
 {
     seed_ = config.get_uint_value("seed");
 
-    std::srand(static_cast<unsigned int>(seed_));
     generator_.seed(seed_);
 }
 
-int Random::random() const
+int Random::random()
+{
+    std::uniform_int_distribution<int> uniform(0, RAND_MAX);
+    return uniform(generator_);
+}
+
+std::shared_ptr<Random> Random::substream(unsigned int index) const
+{
+    return substream({index});
+}
+
+std::shared_ptr<Random> Random::substream(
+                        std::initializer_list<unsigned int> key) const
 {
-    return std::rand();
+    std::vector<unsigned int> words{seed_};
+    words.insert(words.end(), key.begin(), key.end());
+    std::seed_seq sequence(words.begin(), words.end());
+    unsigned int seed = 0;
+    sequence.generate(&seed, &seed + 1);
+    return std::make_shared<Random>(seed);
 }
 
 }
@@ -11,30 +11,30 @@ namespace adef {
 
 void Repair::repair(std::shared_ptr<Repository> repos) const
 {
-    auto pop = repos->offspring();
-    auto pop_size = pop->population_size();
-    for (decltype(pop_size) idx = 0; idx < pop_size; ++idx) {
-        repair(pop->at(idx), repos->problem());
-    }
+    auto&& pop = *repos->offspring();
+    auto&& problem = *repos->problem();
+    repos->for_each_individual(pop.population_size(),
+        [&](const IndividualContext& context) {
+            repair(pop.individual(context.target_index), problem);
+        });
 }
 
-void Repair::repair(std::shared_ptr<Individual> individual,
-                    std::shared_ptr<const Problem> problem) const
+void Repair::repair(Individual& individual, const Problem& problem) const
 {
-    auto dim_decision_space = problem->dimension_of_decision_space();
+    auto dim_decision_space = problem.dimension_of_decision_space();
     for (decltype(dim_decision_space) dim = 0; dim < dim_decision_space; ++dim) {
-        if (!individual->is_valid(dim, problem)) {
+        if (!individual.is_valid(dim, problem)) {
             repair_function(individual, dim, problem);
         }
     }
 }
 
 double Repair::find_nearest_bound(double gene,
-                                  std::shared_ptr<const Problem> problem,
+                                  const Problem& problem,
                                   std::size_t dim) const
 {
-    auto lower_bound = problem->lower_bound_of_decision_space(dim);
-    auto upper_bound = problem->upper_bound_of_decision_space(dim);
+    auto lower_bound = problem.lower_bound_of_decision_space(dim);
+    auto upper_bound = problem.upper_bound_of_decision_space(dim);
 
     if (gene < lower_bound) {
         return lower_bound;
@@ -9,6 +9,7 @@
 #include "Parameters.h"
 #include "Initializer.h"
 #include "Evaluator.h"
+#include "Surrogate.h"
 #include "Population.h"
 #include "Reproduction.h"
 #include "EnvironmentalSelection.h"
@@ -16,40 +17,52 @@
 #include "Crossover.h"
 #include "Repair.h"
 #include "Random.h"
+#include "util/thread_pool.h"
 
 namespace adef {
 
-Repository::Repository() : algorithm_name_("algorithm")
+Repository::Repository() : algorithm_name_("algorithm"), number_of_threads_(1),
+    deterministic_(false), generation_(0)
 {
 }
 
 Repository::Repository(const Repository& rhs) : Prototype(rhs),
-    enable_shared_from_this(rhs), algorithm_name_(rhs.algorithm_name_)
+    enable_shared_from_this(rhs), algorithm_name_(rhs.algorithm_name_),
+    number_of_threads_(rhs.number_of_threads_),
+    deterministic_(rhs.deterministic_), generation_(0)
 {
-    if (rhs.evolution_) { evolution_ = rhs.evolution_->clone(); }
-    if (rhs.problem_) { problem_ = rhs.problem_->clone(); }
-    if (rhs.statistics_) { statistics_ = rhs.statistics_->clone(); }
-    if (rhs.parameters_) { parameters_ = rhs.parameters_->clone(); }
-
-    if (rhs.initializer_) { initializer_ = rhs.initializer_->clone(); }
-    if (rhs.evaluator_) { evaluator_ = rhs.evaluator_->clone(); }
-
-    if (rhs.population_) { population_ = rhs.population_->clone(); }
-    if (rhs.offspring_) { offspring_ = rhs.offspring_->clone(); }
-
-    if (rhs.reproduction_) { reproduction_ = rhs.reproduction_->clone(); }
-    if (rhs.environmental_selection_) {
-            environmental_selection_ = rhs.environmental_selection_->clone();
-    }
-    if (rhs.mutation_) { mutation_ = rhs.mutation_->clone(); }
-    if (rhs.crossover_) { crossover_ = rhs.crossover_->clone(); }
-    if (rhs.repair_) { repair_ = rhs.repair_->clone(); }
+    // the immutable states are shared, the others are cloned
+    evolution_ = share_or_clone(rhs.evolution_);
+    problem_ = share_or_clone(rhs.problem_);
+    statistics_ = share_or_clone(rhs.statistics_);
+    parameters_ = share_or_clone(rhs.parameters_);
+
+    initializer_ = share_or_clone(rhs.initializer_);
+    evaluator_ = share_or_clone(rhs.evaluator_);
+    surrogate_ = share_or_clone(rhs.surrogate_);
+
+    population_ = share_or_clone(rhs.population_);
+    offspring_ = share_or_clone(rhs.offspring_);
+
+    reproduction_ = share_or_clone(rhs.reproduction_);
+    environmental_selection_ = share_or_clone(rhs.environmental_selection_);
+    mutation_ = share_or_clone(rhs.mutation_);
+    crossover_ = share_or_clone(rhs.crossover_);
+    repair_ = share_or_clone(rhs.repair_);
 }
 
 void Repository::setup(const Configuration& config, const PrototypeManager& pm)
 {
     algorithm_name_ = config.get_string_value("algorithm_name");
 
+    auto threads_config = config.get_config("number_of_threads");
+    number_of_threads_ = threads_config.is_null() ?
+                            1 : threads_config.get_uint_value();
+    if (number_of_threads_ == 0) { number_of_threads_ = 1; }
+    auto deterministic_config = config.get_config("deterministic");
+    deterministic_ = deterministic_config.is_null() ?
+                        false : deterministic_config.get_bool_value();
+
     evolution_ = make_and_setup_type<Evolution>("Evolution", config, pm);
     problem_ = make_and_setup_type<Problem>("Problem", config, pm);
     statistics_ = make_and_setup_type<Statistics>("Statistics", config, pm);
@@ -57,6 +70,8 @@ void Repository::setup(const Configuration& config, const PrototypeManager& pm)
 
     initializer_ = make_and_setup_type<Initializer>("Initializer", config, pm);
     evaluator_ = make_and_setup_type<Evaluator>("Evaluator", config, pm);
+    surrogate_ = config.get_config("Surrogate").is_null() ? nullptr :
+                    make_and_setup_type<Surrogate>("Surrogate", config, pm);
 
     population_ = make_and_setup_type<Population>("Population", config, pm);
     // offspring is created through population in init()
@@ -74,6 +89,15 @@ void Repository::init(std::shared_ptr<Random> random)
 {
     random_ = random;
 
+    // the calling thread uses the random generator of Repository
+    thread_pool_ = std::make_shared<ThreadPool>(number_of_threads_);
+    thread_randoms_.clear();
+    thread_randoms_.push_back(random_);
+    for (unsigned int thread = 1; thread < number_of_threads_; ++thread) {
+        thread_randoms_.push_back(random_->substream(thread));
+    }
+    begin_generation(0);
+
     evolution_->init(shared_from_this());
     problem_->init(shared_from_this());
     statistics_->init(shared_from_this());
@@ -81,6 +105,7 @@ void Repository::init(std::shared_ptr<Random> random)
 
     initializer_->init(shared_from_this());
     evaluator_->init(shared_from_this());
+    if (surrogate_) { surrogate_->init(shared_from_this()); }
 
     population_->init(shared_from_this());
     offspring_ = population_->empty_clone();
@@ -92,4 +117,44 @@ void Repository::init(std::shared_ptr<Random> random)
     repair_->init(shared_from_this());
 }
 
+void Repository::begin_generation(unsigned int generation)
+{
+    generation_ = generation;
+    // the generators are derived lazily by the thread which uses them
+    individual_randoms_.assign(individual_randoms_.size(), nullptr);
+}
+
+IndividualContext Repository::context(std::size_t index) const
+{
+    return IndividualContext{index, random_};
+}
+
+void Repository::for_each_individual(
+            std::size_t size,
+            const std::function<void(const IndividualContext&)>& func)
+{
+    if (!deterministic_) {
+        thread_pool_->parallel_for(size,
+            [&](unsigned int thread, std::size_t index) {
+                func(IndividualContext{index, thread_randoms_[thread]});
+            });
+        return;
+    }
+
+    // keyed by (run, generation, individual) where the run is
+    // the seed of random_, and shared by all steps of the generation
+    if (individual_randoms_.size() < size) {
+        individual_randoms_.resize(size);
+    }
+    thread_pool_->parallel_for(size,
+        [&](unsigned int thread, std::size_t index) {
+            auto& random = individual_randoms_[index];
+            if (!random) {
+                random = random_->substream(
+                            {generation_, static_cast<unsigned int>(index)});
+            }
+            func(IndividualContext{index, random});
+        });
+}
+
 }
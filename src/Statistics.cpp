@@ -7,6 +7,7 @@
 #include <iterator>
 #include <algorithm>
 #include <fstream>
+#include <chrono>
 #include <ostream>
 #include "Statistics.h"
 #include "Configuration.h"
@@ -20,12 +21,29 @@ namespace adef {
 
 Statistics::Statistics() :
     success_error_(0.00001),
-    best_fitness_so_far_(std::numeric_limits<double>::max())
+    max_fitness_evaluations_(0),
+    time_limit_(0),
+    stagnation_generations_(0),
+    stagnation_epsilon_(0),
+    names_of_items_(std::make_shared<const std::vector<std::string>>()),
+    best_fitness_so_far_(std::numeric_limits<double>::max()),
+    number_of_fitness_evaluations_(0),
+    number_of_cache_hits_(0),
+    number_of_saved_evaluations_(0),
+    stagnation_fitness_(std::numeric_limits<double>::max()),
+    stagnation_generation_(0)
 {
-    map_item_to_name_[Item::parents] = "parents";
-    map_item_to_name_[Item::offspring] = "offspring";
-    map_item_to_name_[Item::cr] = "cr";
-    map_item_to_name_[Item::f] = "f";
+}
+
+const std::map<Statistics::Item, std::string>& Statistics::map_item_to_name()
+{
+    static const std::map<Item, std::string> map_item_to_name = {
+        { Item::parents, "parents" },
+        { Item::offspring, "offspring" },
+        { Item::cr, "cr" },
+        { Item::f, "f" }
+    };
+    return map_item_to_name;
 }
 
 void Statistics::setup(const Configuration& config, const PrototypeManager& pm)
@@ -34,16 +52,35 @@ void Statistics::setup(const Configuration& config, const PrototypeManager& pm)
     success_error_ = success_error_config.is_null() ?
                         0.00001 : success_error_config.get_double_value();
 
+    auto names_of_items = std::make_shared<std::vector<std::string>>();
     auto item_config = config.get_config("item");
     auto item_config_size = item_config.get_array_size();
     for (decltype(item_config_size) idx = 0; idx < item_config_size; ++idx) {
         auto name = item_config.get_string_value(idx);
-        names_of_items_.push_back(name);
+        names_of_items->push_back(name);
     }
+    names_of_items_ = names_of_items;
+
+    auto max_fes_config = config.get_config("max_fitness_evaluations");
+    max_fitness_evaluations_ = max_fes_config.is_null() ?
+                                0 : max_fes_config.get_uint_value();
+
+    auto time_limit_config = config.get_config("time_limit");
+    time_limit_ = time_limit_config.is_null() ?
+                    0 : time_limit_config.get_double_value();
+
+    auto stagnation_config = config.get_config("stagnation_generations");
+    stagnation_generations_ = stagnation_config.is_null() ?
+                                0 : stagnation_config.get_uint_value();
+
+    auto epsilon_config = config.get_config("stagnation_epsilon");
+    stagnation_epsilon_ = epsilon_config.is_null() ?
+                            0 : epsilon_config.get_double_value();
 }
 
 void Statistics::init(std::shared_ptr<Repository> repos)
 {
+    start_time_ = std::chrono::steady_clock::now();
 }
 
 bool Statistics::is_evolve_success(std::shared_ptr<const Repository> repos) const
@@ -58,6 +95,43 @@ bool Statistics::is_evolve_success(std::shared_ptr<const Repository> repos) cons
     }
 }
 
+std::string Statistics::termination_reason(
+                                std::shared_ptr<const Repository> repos) const
+{
+    if (is_evolve_success(repos)) {
+        return "success";
+    }
+    if (max_fitness_evaluations_ > 0 &&
+        number_of_fitness_evaluations_ >= max_fitness_evaluations_) {
+        return "max_fitness_evaluations";
+    }
+    if (time_limit_ > 0 && elapsed_time() >= time_limit_) {
+        return "time_limit";
+    }
+    if (stagnation_generations_ > 0 && !best_fitness_.empty() &&
+        best_fitness_.size() - 1 - stagnation_generation_ >=
+            stagnation_generations_) {
+        return "stagnation";
+    }
+    return "";
+}
+
+unsigned int Statistics::remaining_fitness_evaluations() const
+{
+    if (max_fitness_evaluations_ == 0) {
+        return std::numeric_limits<unsigned int>::max();
+    }
+    return number_of_fitness_evaluations_ < max_fitness_evaluations_ ?
+            max_fitness_evaluations_ - number_of_fitness_evaluations_ : 0;
+}
+
+double Statistics::elapsed_time() const
+{
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start_time_;
+    return elapsed.count();
+}
+
 double Statistics::evolve_error(std::shared_ptr<const Repository> repos) const
 {
     if (is_evolve_success(repos)) {
@@ -73,13 +147,13 @@ void Statistics::store_statistics_all_individuals(
                                          const AllIndividualsValueList& values)
 {
     // get the name of the item
-    std::string name = map_item_to_name_.at(item);
+    auto&& name = map_item_to_name().at(item);
     // check whether the name of the item is in the statistical items
-    auto result = std::find(std::begin(names_of_items_),
-                            std::end(names_of_items_),
+    auto result = std::find(std::begin(*names_of_items_),
+                            std::end(*names_of_items_),
                             name);
     // if found, store it
-    if (result != std::end(names_of_items_)) {
+    if (result != std::end(*names_of_items_)) {
         auto search = statistics_all_individuals_.find(item);
         if (search != statistics_all_individuals_.end()) {
             search->second.push_back(values);
@@ -90,6 +164,34 @@ void Statistics::store_statistics_all_individuals(
     }
 }
 
+void Statistics::merge(const Statistics& rhs)
+{
+    for (std::size_t gen = 0; gen < rhs.best_fitness_.size(); ++gen) {
+        if (gen < best_fitness_.size()) {
+            best_fitness_[gen] = std::min(best_fitness_[gen],
+                                          rhs.best_fitness_[gen]);
+        }
+        else {
+            best_fitness_.push_back(rhs.best_fitness_[gen]);
+        }
+    }
+    update_best_fitness_so_far(rhs.best_fitness_so_far_);
+    number_of_fitness_evaluations_ += rhs.number_of_fitness_evaluations_;
+    number_of_cache_hits_ += rhs.number_of_cache_hits_;
+    number_of_saved_evaluations_ += rhs.number_of_saved_evaluations_;
+
+    for (auto& pair : rhs.statistics_all_individuals_) {
+        auto& data = statistics_all_individuals_[pair.first];
+        if (data.size() < pair.second.size()) {
+            data.resize(pair.second.size());
+        }
+        for (std::size_t gen = 0; gen < pair.second.size(); ++gen) {
+            data[gen].insert(data[gen].end(),
+                             pair.second[gen].begin(), pair.second[gen].end());
+        }
+    }
+}
+
 void Statistics::output_statistics(const std::string& prefix) const
 {
     output_best_fitness(prefix);
@@ -98,15 +200,15 @@ void Statistics::output_statistics(const std::string& prefix) const
 
 void Statistics::output_all_statistical_items(const std::string& prefix) const
 {
-    for (auto& name : names_of_items_) {
+    for (auto& name : *names_of_items_) {
         // find key (item) with specific element (name)
-        auto result = std::find_if(std::begin(map_item_to_name_),
-                                   std::end(map_item_to_name_),
+        auto result = std::find_if(std::begin(map_item_to_name()),
+                                   std::end(map_item_to_name()),
                                    [&name](const auto &pair) {
                                         return pair.second == name;
                                    });
         // it should always be found
-        if (result != std::end(map_item_to_name_)) {
+        if (result != std::end(map_item_to_name())) {
             output_statistical_items(prefix + "_" + name + ".csv",
                         statistics_all_individuals_.at(result->first));
         }
@@ -128,8 +230,9 @@ void Statistics::output_statistical_items(const std::string& file_name,
     for (decltype(generation) gen = 0; gen < generation; ++gen) {
         ofs << gen+1 << ",";
 
-        for (decltype(pop_size) idx = 0; idx < pop_size; ++idx) {
-            ofs << data.at(gen).at(idx) << ",";
+        // the islands which stop early have no values of the last generations
+        for (auto&& value : data.at(gen)) {
+            ofs << value << ",";
         }
         ofs << std::endl;
     }
@@ -167,6 +270,12 @@ void Statistics::take_statistics(std::shared_ptr<const Repository> repos)
 
     best_fitness_.push_back(best);
     update_best_fitness_so_far(best);
+
+    // the generation of the latest improvement more than the epsilon
+    if (best_fitness_so_far_ < stagnation_fitness_ - stagnation_epsilon_) {
+        stagnation_fitness_ = best_fitness_so_far_;
+        stagnation_generation_ = best_fitness_.size() - 1;
+    }
 }
 
 void Statistics::take_statistics_population(
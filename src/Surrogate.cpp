@@ -0,0 +1,62 @@
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cmath>
+#include "Surrogate.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+#include "Repository.h"
+#include "Population.h"
+#include "Individual.h"
+#include "Evaluator.h"
+#include "Statistics.h"
+
+namespace adef {
+
+void Surrogate::setup(const Configuration& config, const PrototypeManager& pm)
+{
+    auto margin_config = config.get_config("margin");
+    margin_ = margin_config.is_null() ? 0.0 : margin_config.get_double_value();
+}
+
+void Surrogate::evaluate(std::shared_ptr<Repository> repos)
+{
+    auto&& parent = repos->population();
+    auto&& children = repos->offspring();
+    auto&& statistics = repos->statistics();
+
+    // the initial population is evaluated without Surrogate
+    if (number_of_samples() == 0) {
+        for (std::size_t idx = 0; idx < parent->population_size(); ++idx) {
+            learn(parent->individual(idx));
+        }
+    }
+
+    kept_indexes_.clear();
+    for (std::size_t idx = 0; idx < children->population_size(); ++idx) {
+        auto&& child = children->individual(idx);
+        auto&& target = parent->individual(idx);
+        double predicted = 0;
+        if (predict(child, predicted) &&
+            predicted > target.fitness() + margin_ * std::abs(target.fitness())) {
+            child = target;
+            statistics->increase_number_of_saved_evaluations();
+        }
+        else {
+            kept_indexes_.push_back(idx);
+        }
+    }
+
+    auto kept_children = std::make_shared<Population>();
+    kept_children->share(*children, kept_indexes_);
+    auto kept_targets = std::make_shared<Population>();
+    kept_targets->share(*parent, kept_indexes_);
+    repos->evaluator()->evaluate(kept_children, kept_targets,
+                                 repos->problem(), statistics);
+
+    for (auto idx : kept_indexes_) {
+        learn(children->individual(idx));
+    }
+}
+
+}
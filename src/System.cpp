@@ -1,6 +1,9 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <set>
+#include <cstddef>
+#include <stdexcept>
 #include "System.h"
 #include "SystemStatistics.h"
 #include "Experiment.h"
@@ -14,15 +17,10 @@ System::System() : name_("system")
 }
 
 System::System(const System& rhs) :
-    name_(rhs.name_)
+    name_(rhs.name_), experiment_configs_(rhs.experiment_configs_),
+    number_of_experiments_(rhs.number_of_experiments_), pm_(rhs.pm_)
 {
     if (rhs.statistics_) { statistics_ = rhs.statistics_->clone(); }
-
-    experiments_.resize(rhs.experiments_.size());
-    for (std::size_t idx = 0; idx < rhs.experiments_.size(); ++idx) {
-
-                experiments_[idx] = rhs.experiments_[idx]->clone();
-    }
 }
 
 void System::setup(const Configuration& config, const PrototypeManager& pm)
@@ -31,23 +29,66 @@ void System::setup(const Configuration& config, const PrototypeManager& pm)
     statistics_ = make_and_setup_type<SystemStatistics>("SystemStatistics",
                                                         config, pm);
 
+    pm_ = std::make_shared<PrototypeManager>(pm);
+    experiment_configs_.clear();
+    number_of_experiments_.clear();
     auto exps_config = config.get_config("Experiment");
     auto exp_size = exps_config.get_array_size();
     for (decltype(exp_size) idx = 0; idx < exp_size; ++idx) {
         auto exp_config = exps_config.get_config(idx);
-        auto exp = make_and_setup_type<Experiment>(exp_config, pm);
-        experiments_.push_back(exp);
+        experiment_configs_.push_back(exp_config);
+        number_of_experiments_.push_back(exp_config.get_sweep_size());
     }
 }
 
 void System::run()
 {
-    for (auto&& exp : experiments_) {
-        exp->run();
+    std::set<std::string> names;
+    for (std::size_t idx = 0; idx < experiment_configs_.size(); ++idx) {
+        for (unsigned int comb = 0; comb < number_of_experiments_[idx];
+             ++comb) {
+            auto exp = make_experiment(idx, comb);
+            // the outputs of the same name overwrite each other
+            if (!names.insert(exp->name()).second) {
+                throw std::logic_error("System has more than one "
+                                       "experiment named " + exp->name() +
+                                       ".");
+            }
+            exp->run();
 
-        statistics_->take_statistics(exp);
+            statistics_->take_statistics(exp);
+        }
     }
     statistics_->output_statistics(name_);
 }
 
+std::size_t System::number_of_experiments() const
+{
+    std::size_t count = 0;
+    for (auto number : number_of_experiments_) { count += number; }
+    return count;
+}
+
+std::shared_ptr<Experiment> System::make_experiment(std::size_t index) const
+{
+    for (std::size_t idx = 0; idx < experiment_configs_.size(); ++idx) {
+        if (index < number_of_experiments_[idx]) {
+            return make_experiment(idx, static_cast<unsigned int>(index));
+        }
+        index -= number_of_experiments_[idx];
+    }
+    throw std::out_of_range("System does not have the experiment.");
+}
+
+std::shared_ptr<Experiment> System::make_experiment(
+                                        std::size_t config_index,
+                                        unsigned int combination) const
+{
+    auto&& exp_config = experiment_configs_[config_index];
+    auto exp = make_and_setup_type<Experiment>(
+                    exp_config.get_sweep_config(combination), *pm_);
+    exp->add_label(exp_config.get_sweep_label(combination));
+    return exp;
+}
+
 }
@@ -0,0 +1,100 @@
+#include <memory>
+#include <string>
+#include <exception>
+#include "adef_ask_tell.h"
+#include "AskTell.h"
+#include "Individual.h"
+
+struct adef_ask_tell {
+
+    std::shared_ptr<adef::AskTell> ask_tell;
+};
+
+namespace {
+
+thread_local std::string last_error;
+
+/**
+@brief Call the function and keep the message of its exception.
+@return Zero on success.
+*/
+template<typename Function>
+int call(Function&& function)
+{
+    try {
+        function();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        last_error = e.what();
+    }
+    catch (...) {
+        last_error = "unknown error";
+    }
+    return 1;
+}
+
+}
+
+extern "C" {
+
+adef_ask_tell* adef_ask_tell_create(const char* config_file,
+                                    size_t experiment,
+                                    unsigned int run)
+{
+    adef_ask_tell* session = nullptr;
+    call([&] {
+        auto ask_tell = adef::AskTell::create(config_file, experiment, run);
+        session = new adef_ask_tell{ ask_tell };
+    });
+    return session;
+}
+
+void adef_ask_tell_destroy(adef_ask_tell* session)
+{
+    delete session;
+}
+
+int adef_ask(adef_ask_tell* session, const double* const** variables,
+             size_t* size, size_t* dimension)
+{
+    return call([&] {
+        auto batch = session->ask_tell->ask();
+        *variables = batch.variables;
+        *size = batch.size;
+        *dimension = batch.dimension;
+    });
+}
+
+int adef_tell(adef_ask_tell* session, const double* fitness)
+{
+    return call([&] { session->ask_tell->tell(fitness); });
+}
+
+int adef_ask_tell_is_terminated(const adef_ask_tell* session)
+{
+    return session->ask_tell->is_terminated() ? 1 : 0;
+}
+
+unsigned int adef_ask_tell_generation(const adef_ask_tell* session)
+{
+    return session->ask_tell->generation();
+}
+
+int adef_ask_tell_best(const adef_ask_tell* session, double* fitness,
+                       const double** variables, size_t* dimension)
+{
+    return call([&] {
+        auto&& best = session->ask_tell->best();
+        *fitness = best.fitness();
+        *variables = best.variable_data();
+        *dimension = best.dimension_of_variable();
+    });
+}
+
+const char* adef_ask_tell_last_error(void)
+{
+    return last_error.c_str();
+}
+
+}
@@ -10,22 +10,31 @@
 
 namespace adef {
 
-void SadeCrControlMechanism::select(std::shared_ptr<Repository> repos)
+void SadeCrControlMechanism::init(std::shared_ptr<Repository> repos)
 {
-    auto index = repos->parameters()->take_out<std::size_t>("target_index");
-    auto func = function_->at(index)->get_function("mean");
-    selection_->select(repos, parameter_, func);
+    ControlMechanism<T>::init(repos);
+    mean_slot_ = function_->at(0)->function_slot("mean");
+    bind_record_targets(*function_->at(0)->function_at(mean_slot_));
 }
 
-void SadeCrControlMechanism::update(std::shared_ptr<Repository> repos)
+void SadeCrControlMechanism::select(std::shared_ptr<Repository> repos,
+                                    const IndividualContext& context)
 {
-    auto index = repos->parameters()->take_out<std::size_t>("target_index");
-    auto func = function_->at(index)->get_function("mean");
+    auto index = context.target_index;
+    auto& func = function_->at(index)->function_at(mean_slot_);
+    selection_->select(repos, context, parameter_, func);
+}
+
+void SadeCrControlMechanism::update(std::shared_ptr<Repository> repos,
+                                    const IndividualContext& context)
+{
+    auto index = context.target_index;
+    auto& func = function_->at(index)->function_at(mean_slot_);
     for (auto& update : updates_) {
-        update->update(repos, parameter_, func);
+        update->update(repos, context, parameter_, func);
     }
 
-    function_->at(index)->update();
+    update_function(index);
     parameter_->reset_already_generated(index);
 }
 
@@ -10,9 +10,11 @@
 
 namespace adef {
 
-SdeFControlMechanism::Object SdeFControlMechanism::generate(std::shared_ptr<Repository> repos)
+SdeFControlMechanism::Object SdeFControlMechanism::generate(
+                                    std::shared_ptr<Repository> repos,
+                                    const IndividualContext& context)
 {
-    auto index = repos->parameters()->take_out<std::size_t>("target_index");
+    auto index = context.target_index;
 
     if (parameter_->is_already_generated(index))
     {
@@ -13,8 +13,7 @@ MultipleControlFunction::MultipleControlFunction(const MultipleControlFunction&
 {
     functions_.reserve(rhs.functions_.size());
     for (auto&& func : rhs.functions_) {
-        if (func) { functions_.push_back(func->clone()); }
-        else { functions_.push_back(nullptr); }
+        functions_.push_back(BaseFunction::share_or_clone(func));
     }
 }
 
@@ -25,7 +24,7 @@ void MultipleControlFunction::setup(const Configuration& config, const Prototype
 
     auto function = make_and_setup_type<BaseFunction>("Function", config, pm);
     for (decltype(size) idx = 0; idx < size; ++idx) {
-        functions_.push_back(function->clone());
+        functions_.push_back(BaseFunction::share_or_clone(function));
     }
 }
 
@@ -37,7 +36,7 @@ void MultipleControlFunction::init(std::shared_ptr<Repository> repos)
     }
 }
 
-std::shared_ptr<BaseFunction> MultipleControlFunction::at(std::size_t index)
+const std::shared_ptr<BaseFunction>& MultipleControlFunction::at(std::size_t index)
 {
     return functions_.at(index);
 }
@@ -9,7 +9,7 @@ namespace adef {
 
 SingleControlFunction::SingleControlFunction(const SingleControlFunction& rhs) :
     ControlFunction(rhs),
-    function_(rhs.function_ ? rhs.function_->clone() : nullptr)
+    function_(BaseFunction::share_or_clone(rhs.function_))
 {
 }
 
@@ -2,28 +2,34 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <stdexcept>
+#include <cstddef>
 #include "cm/cf/func/BaseFunction.h"
 #include "Repository.h"
 #include "Random.h"
 
 namespace adef {
 
-BaseFunction::BaseFunction() : name_("root"), functions_()
+BaseFunction::BaseFunction() : functions_()
 {
+    static const auto root = std::make_shared<const std::string>("root");
+    name_ = root;
 }
 
 BaseFunction::BaseFunction(const BaseFunction & rhs) : Prototype(rhs), name_(rhs.name_)
 {
     functions_.reserve(rhs.functions_.size());
     for (auto&& func : rhs.functions_) {
-        if (func) { functions_.push_back(func->clone()); }
-        else { functions_.push_back(nullptr); }
+        functions_.push_back(share_or_clone(func));
     }
 }
 
 void BaseFunction::init(std::shared_ptr<Repository> repos)
 {
     random_ = repos->random();
+    for (auto&& func : functions_) {
+        if (func) { func->init(repos); }
+    }
 }
 
 void BaseFunction::add_function(BaseFunctionPtr function)
@@ -48,6 +54,37 @@ BaseFunction::BaseFunctionPtr BaseFunction::get_function(const std::string & nam
     }
 }
 
+BaseFunction* BaseFunction::find_function(std::string_view name) const
+{
+    for (auto&& function : functions_) {
+        if (function && function->function_name() == name) {
+            return function.get();
+        }
+    }
+    return nullptr;
+}
+
+std::size_t BaseFunction::record_slot(std::string_view name) const
+{
+    for (std::size_t slot = 0; slot < functions_.size(); ++slot) {
+        if (functions_[slot] && functions_[slot]->function_name() == name) {
+            return slot;
+        }
+    }
+    return no_slot;
+}
+
+std::size_t BaseFunction::function_slot(const std::string& name) const
+{
+    for (std::size_t slot = 0; slot < functions_.size(); ++slot) {
+        if (functions_[slot] && functions_[slot]->function_name() == name) {
+            return slot;
+        }
+    }
+    throw std::logic_error("No functions named \"" + name + "\" "
+                           "in the \"" + function_name() + "\"");
+}
+
 BaseFunction::BaseFunctionPtrList BaseFunction::get_all_functions() const
 {
     return functions_;
@@ -4,6 +4,7 @@
 #include <cmath>
 #include <limits>
 #include "cm/cf/func/DepdFFunction.h"
+#include "cm/cf/func/FunctionProgram.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "Individual.h"
@@ -27,6 +28,10 @@ void DepdFFunction::setup(const Configuration & config, const PrototypeManager &
     lower_bound->set_function_name("lower_bound");
     add_function(lower_bound);
 
+    min_slot_ = bind_function("min");
+    max_slot_ = bind_function("max");
+    lower_bound_slot_ = bind_function("lower_bound");
+
     min_ = 0;
     max_ = 0;
     lower_bound_ = 0.0;
@@ -47,19 +52,23 @@ DepdFFunction::Object DepdFFunction::generate()
     }
 }
 
-void DepdFFunction::update()
+template<typename Updater>
+void DepdFFunction::update_components(Updater&& updater)
 {
-    auto min = get_function("min");
-    min->update();
-    min_ = min->generate();
+    updater.pull(*function_at(min_slot_), min_);
+    updater.pull(*function_at(max_slot_), max_);
+    updater.pull(*function_at(lower_bound_slot_), lower_bound_);
+}
 
-    auto max = get_function("max");
-    max->update();
-    max_ = max->generate();
+void DepdFFunction::update()
+{
+    update_components(DirectUpdate());
+}
 
-    auto lower_bound = get_function("lower_bound");
-    lower_bound->update();
-    lower_bound_ = lower_bound->generate();
+bool DepdFFunction::lower_update(FunctionProgram& program)
+{
+    update_components(program);
+    return true;
 }
 
 unsigned int DepdFFunction::number_of_parameters() const
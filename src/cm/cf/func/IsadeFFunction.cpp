@@ -5,6 +5,7 @@
 #include <limits>
 #include <random>
 #include "cm/cf/func/IsadeFFunction.h"
+#include "cm/cf/func/FunctionProgram.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "Random.h"
@@ -39,6 +40,12 @@ void IsadeFFunction::setup(const Configuration & config, const PrototypeManager
     tau->set_function_name("tau");
     add_function(tau);
 
+    object_slot_ = bind_function("object");
+    min_slot_ = bind_function("min");
+    average_slot_ = bind_function("average");
+    current_slot_ = bind_function("current");
+    tau_slot_ = bind_function("tau");
+
     object_ = 0;
     min_ = 0;
     average_ = 0;
@@ -66,27 +73,25 @@ IsadeFFunction::Object IsadeFFunction::generate()
     }
 }
 
-void IsadeFFunction::update()
+template<typename Updater>
+void IsadeFFunction::update_components(Updater&& updater)
 {
-    auto object = get_function("object");
-    object->update();
-    object_ = object->generate();
-
-    auto min = get_function("min");
-    min->update();
-    min_ = min->generate();
-
-    auto average = get_function("average");
-    average->update();
-    average_ = average->generate();
+    updater.pull(*function_at(object_slot_), object_);
+    updater.pull(*function_at(min_slot_), min_);
+    updater.pull(*function_at(average_slot_), average_);
+    updater.pull(*function_at(current_slot_), current_);
+    updater.pull(*function_at(tau_slot_), tau_);
+}
 
-    auto current = get_function("current");
-    current->update();
-    current_ = current->generate();
+void IsadeFFunction::update()
+{
+    update_components(DirectUpdate());
+}
 
-    auto tau = get_function("tau");
-    tau->update();
-    tau_ = tau->generate();
+bool IsadeFFunction::lower_update(FunctionProgram& program)
+{
+    update_components(program);
+    return true;
 }
 
 unsigned int IsadeFFunction::number_of_parameters() const
@@ -2,7 +2,9 @@
 #include <vector>
 #include <string>
 #include <random>
+#include <cstddef>
 #include "cm/cf/func/JdeCrFunction.h"
+#include "cm/cf/func/FunctionProgram.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "Random.h"
@@ -22,6 +24,9 @@ void JdeCrFunction::setup(const Configuration & config, const PrototypeManager &
     tau->set_function_name("tau");
     add_function(tau);
 
+    object_slot_ = bind_function("object");
+    tau_slot_ = bind_function("tau");
+
     object_ = 0.9;
     tau_ = 0.1;
 }
@@ -37,15 +42,38 @@ JdeCrFunction::Object JdeCrFunction::generate()
     }
 }
 
+void JdeCrFunction::generate_all(Function<T>* const* functions,
+                                 std::size_t size, Object* objects)
+{
+    std::uniform_real_distribution<> uniform;
+    for (std::size_t idx = 0; idx < size; ++idx) {
+        auto func = static_cast<JdeCrFunction*>(functions[idx]);
+        auto& random = func->random_;
+        if (random->generate(uniform) < func->tau_) {
+            objects[idx] = random->generate(uniform);
+        }
+        else {
+            objects[idx] = func->object_;
+        }
+    }
+}
+
+template<typename Updater>
+void JdeCrFunction::update_components(Updater&& updater)
+{
+    updater.pull(*function_at(object_slot_), object_);
+    updater.pull(*function_at(tau_slot_), tau_);
+}
+
 void JdeCrFunction::update()
 {
-    auto object = get_function("object");
-    object->update();
-    object_ = object->generate();
+    update_components(DirectUpdate());
+}
 
-    auto tau = get_function("tau");
-    tau->update();
-    tau_ = tau->generate();
+bool JdeCrFunction::lower_update(FunctionProgram& program)
+{
+    update_components(program);
+    return true;
 }
 
 unsigned int JdeCrFunction::number_of_parameters() const
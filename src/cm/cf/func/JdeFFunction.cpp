@@ -2,7 +2,9 @@
 #include <vector>
 #include <string>
 #include <random>
+#include <cstddef>
 #include "cm/cf/func/JdeFFunction.h"
+#include "cm/cf/func/FunctionProgram.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
 #include "Random.h"
@@ -32,6 +34,11 @@ void JdeFFunction::setup(const Configuration& config, const PrototypeManager& pm
     tau->set_function_name("tau");
     add_function(tau);
 
+    object_slot_ = bind_function("object");
+    lower_bound_slot_ = bind_function("lower_bound");
+    upper_bound_slot_ = bind_function("upper_bound");
+    tau_slot_ = bind_function("tau");
+
     object_ = 0.5;
     lower_bound_ = 0.1;
     upper_bound_ = 0.9;
@@ -50,23 +57,41 @@ JdeFFunction::Object JdeFFunction::generate()
     }
 }
 
-void JdeFFunction::update()
+void JdeFFunction::generate_all(Function<T>* const* functions,
+                                std::size_t size, Object* objects)
 {
-    auto object = get_function("object");
-    object->update();
-    object_ = object->generate();
+    std::uniform_real_distribution<> uniform;
+    for (std::size_t idx = 0; idx < size; ++idx) {
+        auto func = static_cast<JdeFFunction*>(functions[idx]);
+        auto& random = func->random_;
+        if (random->generate(uniform) < func->tau_) {
+            objects[idx] = func->lower_bound_ +
+                           random->generate(uniform) * func->upper_bound_;
+        }
+        else {
+            objects[idx] = func->object_;
+        }
+    }
+}
 
-    auto lower_bound = get_function("lower_bound");
-    lower_bound->update();
-    lower_bound_ = lower_bound->generate();
+template<typename Updater>
+void JdeFFunction::update_components(Updater&& updater)
+{
+    updater.pull(*function_at(object_slot_), object_);
+    updater.pull(*function_at(lower_bound_slot_), lower_bound_);
+    updater.pull(*function_at(upper_bound_slot_), upper_bound_);
+    updater.pull(*function_at(tau_slot_), tau_);
+}
 
-    auto upper_bound = get_function("upper_bound");
-    upper_bound->update();
-    upper_bound_ = upper_bound->generate();
+void JdeFFunction::update()
+{
+    update_components(DirectUpdate());
+}
 
-    auto tau = get_function("tau");
-    tau->update();
-    tau_ = tau->generate();
+bool JdeFFunction::lower_update(FunctionProgram& program)
+{
+    update_components(program);
+    return true;
 }
 
 unsigned int JdeFFunction::number_of_parameters() const
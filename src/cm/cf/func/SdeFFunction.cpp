@@ -3,6 +3,7 @@
 #include <string>
 #include <any>
 #include "cm/cf/func/SdeFFunction.h"
+#include "cm/cf/func/FunctionProgram.h"
 #include "cm/ControlledObject.h"
 #include "Configuration.h"
 #include "PrototypeManager.h"
@@ -17,6 +18,8 @@ void SdeFFunction::setup(const Configuration & config, const PrototypeManager &
     rand->set_function_name("rand");
     add_function(rand);
 
+    rand_slot_ = bind_function("rand");
+
     parameters_.resize(config.get_uint_value("number_of_parameters"));
 }
 
@@ -27,7 +30,7 @@ SdeFFunction::Object SdeFFunction::generate()
     for (decltype(size) idx = 1; idx < size; idx += 2) {
         diff += parameters_.at(idx) - parameters_.at(idx + 1);
     }
-    return parameters_.at(0) + get_function("rand")->generate() * diff;
+    return parameters_.at(0) + function_at(rand_slot_)->generate() * diff;
 }
 
 bool SdeFFunction::record(const std::vector<std::any>& params, const std::string & name)
@@ -48,9 +51,39 @@ bool SdeFFunction::record(const std::vector<std::any>& params, std::shared_ptr<c
     return record(params, name);
 }
 
+bool SdeFFunction::record(RecordValues params, std::string_view name)
+{
+    if (params.size() == parameters_.size()) {
+        for (decltype(params.size()) idx = 0; idx < params.size(); ++idx) {
+            parameters_[idx] = record_cast<Object>(params[idx]);
+        }
+    }
+    else {
+        throw std::logic_error("SdeFFunction accept wrong parameters.");
+    }
+    return true;
+}
+
+bool SdeFFunction::record(RecordValues params, const std::shared_ptr<const Individual>& parent, const std::shared_ptr<const Individual>& offspring, std::string_view name)
+{
+    return record(params, name);
+}
+
+template<typename Updater>
+void SdeFFunction::update_components(Updater&& updater)
+{
+    updater.update(*function_at(rand_slot_));
+}
+
 void SdeFFunction::update()
 {
-    get_function("rand")->update();
+    update_components(DirectUpdate());
+}
+
+bool SdeFFunction::lower_update(FunctionProgram& program)
+{
+    update_components(program);
+    return true;
 }
 
 unsigned int SdeFFunction::number_of_parameters() const
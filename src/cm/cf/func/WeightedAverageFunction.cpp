@@ -33,10 +33,27 @@ bool WeightedAverageFunction::record(const std::vector<std::any>& params, const
 
 bool WeightedAverageFunction::record(const std::vector<std::any>& params, std::shared_ptr<const Individual> parent, std::shared_ptr<const Individual> offspring, const std::string & name)
 {
-    auto& valued_object = valued_objects_.at(valued_object_counter_);
+    // only one param
+    store(std::any_cast<Object>(params.front()), parent, offspring);
+    return true;
+}
+
+bool WeightedAverageFunction::record(RecordValues params, std::string_view name)
+{
+    return true;
+}
 
+bool WeightedAverageFunction::record(RecordValues params, const std::shared_ptr<const Individual>& parent, const std::shared_ptr<const Individual>& offspring, std::string_view name)
+{
     // only one param
-    valued_object.object_ = CO::create(std::any_cast<Object>(params.front()));
+    store(record_cast<Object>(params.front()), parent, offspring);
+    return true;
+}
+
+void WeightedAverageFunction::store(const Object& object, const std::shared_ptr<const Individual>& parent, const std::shared_ptr<const Individual>& offspring)
+{
+    auto& valued_object = valued_objects_.at(valued_object_counter_);
+    valued_object.object_ = CO::create(object);
 
     valued_object.score_ =
         scoring_function_->calculate_score(parent, offspring);
@@ -45,7 +62,6 @@ bool WeightedAverageFunction::record(const std::vector<std::any>& params, std::s
     if (valued_object_counter_ >= object_size_) {
         valued_object_counter_ = 0;
     }
-    return true;
 }
 
 void WeightedAverageFunction::update()
@@ -12,7 +12,7 @@ void NonInfoControlSelection::setup(const Configuration & config, const Prototyp
 {
 }
 
-void NonInfoControlSelection::select(std::shared_ptr<Repository> repos, std::shared_ptr<BaseControlParameter> parameter, std::shared_ptr<BaseFunction> function) const
+void NonInfoControlSelection::select(const std::shared_ptr<Repository>& repos, const IndividualContext& context, const std::shared_ptr<BaseControlParameter>& parameter, const std::shared_ptr<BaseFunction>& function) const
 {
 }
 
@@ -15,12 +15,15 @@ void AverageFitnessControlUpdate::setup(const Configuration & config, const Prot
 {
 }
 
-void AverageFitnessControlUpdate::update(std::shared_ptr<Repository> repos,
-    std::shared_ptr<BaseControlParameter> parameter,
-    std::shared_ptr<BaseFunction> function) const
+void AverageFitnessControlUpdate::update(const std::shared_ptr<Repository>& repos,
+    const IndividualContext& context,
+    const std::shared_ptr<BaseControlParameter>& parameter,
+    const std::shared_ptr<BaseFunction>& function) const
 {
     double average_fitness = find_average_fitness(repos->population());
-    auto succ = function->record({ average_fitness }, "average");
+    RecordValue values[] = { average_fitness };
+    auto succ = target_.resolve(*function).record(RecordValues(values),
+                                                  target_.name());
     if (!succ) {
         throw std::runtime_error(
             "No functions accept parameters \"average\" "
@@ -32,6 +35,8 @@ double AverageFitnessControlUpdate::find_average_fitness(std::shared_ptr<const P
 {
     auto pop_size = pop->population_size();
 
+    // sum in the order of indexes so that the result does not depend on
+    // how individuals are processed across threads
     double average = 0;
     for (decltype(pop_size) idx = 0; idx < pop_size; ++idx) {
         average += pop->at(idx)->fitness();
@@ -17,11 +17,13 @@ void CurrentFitnessControlUpdate::setup(const Configuration & config, const Prot
 {
 }
 
-void CurrentFitnessControlUpdate::update(std::shared_ptr<Repository> repos, std::shared_ptr<BaseControlParameter> parameter, std::shared_ptr<BaseFunction> function) const
+void CurrentFitnessControlUpdate::update(const std::shared_ptr<Repository>& repos, const IndividualContext& context, const std::shared_ptr<BaseControlParameter>& parameter, const std::shared_ptr<BaseFunction>& function) const
 {
-    auto index = repos->parameters()->take_out<std::size_t>("target_index");
+    auto index = context.target_index;
     auto current_fitness = repos->population()->at(index)->fitness();
-    auto succ = function->record({ current_fitness }, "current");
+    RecordValue values[] = { current_fitness };
+    auto succ = target_.resolve(*function).record(RecordValues(values),
+                                                  target_.name());
     if (!succ) {
         throw std::runtime_error(
             "No functions accept parameters \"current\" "
@@ -15,11 +15,13 @@ void GenerationControlUpdate::setup(const Configuration & config, const Prototyp
 {
 }
 
-void GenerationControlUpdate::update(std::shared_ptr<Repository> repos, std::shared_ptr<BaseControlParameter> parameter, std::shared_ptr<BaseFunction> function) const
+void GenerationControlUpdate::update(const std::shared_ptr<Repository>& repos, const IndividualContext& context, const std::shared_ptr<BaseControlParameter>& parameter, const std::shared_ptr<BaseFunction>& function) const
 {
-    std::string name = "generation";
+    auto& name = target_.name();
     auto generation = repos->parameters()->take_out<unsigned int>(name);
-    auto succ = function->record({ generation }, name);
+    // the generation is recorded into IntegerFunction
+    RecordValue values[] = { static_cast<int>(generation) };
+    auto succ = target_.resolve(*function).record(RecordValues(values), name);
     if (!succ) {
         throw std::runtime_error(
             "No functions accept parameters \"" + name + "\" "
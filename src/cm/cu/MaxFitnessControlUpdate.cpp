@@ -16,10 +16,12 @@ void MaxFitnessControlUpdate::setup(const Configuration & config, const Prototyp
 {
 }
 
-void MaxFitnessControlUpdate::update(std::shared_ptr<Repository> repos, std::shared_ptr<BaseControlParameter> parameter, std::shared_ptr<BaseFunction> function) const
+void MaxFitnessControlUpdate::update(const std::shared_ptr<Repository>& repos, const IndividualContext& context, const std::shared_ptr<BaseControlParameter>& parameter, const std::shared_ptr<BaseFunction>& function) const
 {
     double max_fitness = find_max_fitness(repos->population());
-    auto succ = function->record({ max_fitness }, "max");
+    RecordValue values[] = { max_fitness };
+    auto succ = target_.resolve(*function).record(RecordValues(values),
+                                                  target_.name());
     if (!succ) {
         throw std::runtime_error(
             "No functions accept parameters \"max\" "
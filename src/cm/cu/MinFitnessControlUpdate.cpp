@@ -16,10 +16,12 @@ void MinFitnessControlUpdate::setup(const Configuration & config, const Prototyp
 {
 }
 
-void MinFitnessControlUpdate::update(std::shared_ptr<Repository> repos, std::shared_ptr<BaseControlParameter> parameter, std::shared_ptr<BaseFunction> function) const
+void MinFitnessControlUpdate::update(const std::shared_ptr<Repository>& repos, const IndividualContext& context, const std::shared_ptr<BaseControlParameter>& parameter, const std::shared_ptr<BaseFunction>& function) const
 {
     double min_fitness = find_min_fitness(repos->population());
-    auto succ = function->record({ min_fitness }, "min");
+    RecordValue values[] = { min_fitness };
+    auto succ = target_.resolve(*function).record(RecordValues(values),
+                                                  target_.name());
     if (!succ) {
         throw std::runtime_error(
             "No functions accept parameters \"min\" "
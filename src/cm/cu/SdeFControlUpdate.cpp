@@ -1,7 +1,6 @@
 #include <memory>
 #include <string>
 #include <vector>
-#include <any>
 #include <stdexcept>
 #include "cm/cu/SdeFControlUpdate.h"
 #include "Configuration.h"
@@ -18,9 +17,10 @@ void SdeFControlUpdate::setup(const Configuration& config, const PrototypeManage
 {
 }
 
-void SdeFControlUpdate::update(std::shared_ptr<Repository> repos,
-    std::shared_ptr<BaseControlParameter> parameter,
-    std::shared_ptr<BaseFunction> function) const
+void SdeFControlUpdate::update(const std::shared_ptr<Repository>& repos,
+    const IndividualContext& context,
+    const std::shared_ptr<BaseControlParameter>& parameter,
+    const std::shared_ptr<BaseFunction>& function) const
 {
     auto param = std::dynamic_pointer_cast<ControlParameter<Object>>(parameter);
     auto func = std::dynamic_pointer_cast<Function<Object>>(function);
@@ -33,11 +33,11 @@ void SdeFControlUpdate::update(std::shared_ptr<Repository> repos,
         repos->population()->population_size(),
         repos->random());
 
-    std::vector<std::any> record;
+    RecordBuffer<8> record;
     for (auto& index : indices) {
         record.push_back(param->load(index));
     }
-    auto succ = func->record(record);
+    auto succ = func->record(record.values(), "");
     if (!succ) {
         throw std::runtime_error(
             "No functions accept parameters "
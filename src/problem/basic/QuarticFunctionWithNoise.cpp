@@ -24,19 +24,19 @@ void QuarticFunctionWithNoise::setup(const Configuration& config, const Prototyp
     optimal_solution_ = 0.0;
 }
 
-void QuarticFunctionWithNoise::evaluation_function(std::shared_ptr<Individual> individual) const
+void QuarticFunctionWithNoise::evaluation_function(Individual& individual) const
 {
     Object sum = 0.0;
     for (unsigned int idx = 0; idx < dimension_of_decision_space_; ++idx) {
 
-        Object temp = individual->variables(idx);
+        Object temp = individual.variables(idx);
         sum += (idx + 1.0) * temp * temp * temp * temp;
     }
     std::uniform_real_distribution<> uniform(0.0, 1.0);
     sum += random_->generate(uniform);
 
-    individual->objectives() = sum;
-    individual->set_fitness_value(sum);
+    individual.objectives() = sum;
+    individual.set_fitness_value(sum);
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include "problem/cec/CompositionFunction.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+
+namespace adef {
+
+void CompositionFunction::setup(const Configuration& config,
+                                const PrototypeManager& pm)
+{
+    components_.clear();
+    name_ = "Composition";
+    auto components_config = config.get_config("components");
+    auto size = components_config.get_array_size();
+    for (decltype(size) idx = 0; idx < size; ++idx) {
+        auto component_config = components_config.get_config(idx);
+
+        Component component;
+        component.function = &find_basic_function(
+                                component_config.get_string_value("function"));
+        name_ += component.function->problem_name;
+        auto sigma_config = component_config.get_config("sigma");
+        component.sigma = sigma_config.is_null() ?
+                            10.0 : sigma_config.get_double_value();
+        auto lambda_config = component_config.get_config("lambda");
+        component.lambda = lambda_config.is_null() ?
+                            1.0 : lambda_config.get_double_value();
+        auto bias_config = component_config.get_config("bias");
+        component.bias = bias_config.is_null() ?
+                            100.0 * idx : bias_config.get_double_value();
+        components_.push_back(component);
+    }
+    if (components_.empty()) {
+        throw std::domain_error("CompositionFunction has no components.");
+    }
+
+    // the number of the components decides the data
+    TransformedProblem::setup(config, pm);
+}
+
+CompositionFunction::Object CompositionFunction::transformed_function(
+                                            const Object* const* shifted,
+                                            const Object* const* rotated,
+                                            Object* workspace) const
+{
+    auto dimension = dimension_of_decision_space_;
+    Object sum_weight = 0.0;
+    Object sum = 0.0;
+    Object sum_value = 0.0;
+    for (std::size_t idx = 0; idx < components_.size(); ++idx) {
+        auto&& component = components_[idx];
+        auto value = component.lambda *
+                     component.function->evaluate(rotated[idx], dimension) +
+                     component.bias;
+
+        Object distance = 0.0;
+        for (std::size_t dim = 0; dim < dimension; ++dim) {
+            distance += shifted[idx][dim] * shifted[idx][dim];
+        }
+        // the weight is infinite at the optimum of the component
+        if (distance == 0.0) { return value; }
+
+        auto weight = std::exp(-distance / (2.0 * dimension *
+                                            component.sigma * component.sigma)) /
+                      std::sqrt(distance);
+        sum_weight += weight;
+        sum += weight * value;
+        sum_value += value;
+    }
+
+    // all weights underflow far from the optima
+    if (sum_weight == 0.0) {
+        return sum_value / components_.size();
+    }
+    return sum / sum_weight;
+}
+
+}
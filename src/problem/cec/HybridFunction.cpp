@@ -0,0 +1,93 @@
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include "problem/cec/HybridFunction.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+
+namespace adef {
+
+void HybridFunction::setup(const Configuration& config,
+                           const PrototypeManager& pm)
+{
+    functions_.clear();
+    name_ = "Hybrid";
+    auto functions_config = config.get_config("functions");
+    auto size = functions_config.get_array_size();
+    for (decltype(size) idx = 0; idx < size; ++idx) {
+        functions_.push_back(
+            &find_basic_function(functions_config.get_string_value(idx)));
+        name_ += functions_.back()->problem_name;
+    }
+    if (functions_.empty()) {
+        throw std::domain_error("HybridFunction has no functions.");
+    }
+
+    TransformedProblem::setup(config, pm);
+
+    std::vector<double> proportions(size, 1.0 / size);
+    auto proportions_config = config.get_config("proportions");
+    if (!proportions_config.is_null()) {
+        if (proportions_config.get_array_size() != size) {
+            throw std::domain_error("The proportions of HybridFunction "
+                                    "should have as many elements as "
+                                    "the functions.");
+        }
+        double sum = 0.0;
+        for (decltype(size) idx = 0; idx < size; ++idx) {
+            proportions[idx] = proportions_config.get_double_value(idx);
+            if (!(proportions[idx] > 0.0)) {
+                throw std::domain_error("The proportions of HybridFunction "
+                                        "should be positive.");
+            }
+            sum += proportions[idx];
+        }
+        // tolerate the rounding errors of the decimal proportions
+        if (sum > 1.0 + 1e-9) {
+            throw std::domain_error("The proportions of HybridFunction "
+                                    "should not sum to more than 1.");
+        }
+    }
+
+    sizes_.clear();
+    std::size_t total = 0;
+    for (decltype(size) idx = 0; idx + 1 < size; ++idx) {
+        sizes_.push_back(static_cast<std::size_t>(
+                std::ceil(proportions[idx] * dimension_of_decision_space_)));
+        total += sizes_.back();
+    }
+    if (total > dimension_of_decision_space_) {
+        throw std::domain_error("The groups of HybridFunction exceed "
+                                "the dimension.");
+    }
+    sizes_.push_back(dimension_of_decision_space_ - total);
+
+    permutation_ = std::make_shared<const std::vector<std::size_t>>(
+        TransformData::generate_permutation(dimension_of_decision_space_,
+                                            seed_));
+}
+
+HybridFunction::Object HybridFunction::transformed_function(
+                                            const Object* const* shifted,
+                                            const Object* const* rotated,
+                                            Object* workspace) const
+{
+    auto&& permutation = *permutation_;
+    for (std::size_t dim = 0; dim < dimension_of_decision_space_; ++dim) {
+        workspace[dim] = rotated[0][permutation[dim]];
+    }
+
+    Object sum = 0.0;
+    std::size_t first = 0;
+    for (std::size_t idx = 0; idx < functions_.size(); ++idx) {
+        if (sizes_[idx] > 0) {
+            sum += functions_[idx]->evaluate(workspace + first, sizes_[idx]);
+        }
+        first += sizes_[idx];
+    }
+    return sum;
+}
+
+}
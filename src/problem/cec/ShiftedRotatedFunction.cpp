@@ -0,0 +1,25 @@
+#include <string>
+#include "problem/cec/ShiftedRotatedFunction.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+
+namespace adef {
+
+void ShiftedRotatedFunction::setup(const Configuration& config,
+                                   const PrototypeManager& pm)
+{
+    function_ = &find_basic_function(config.get_string_value("function"));
+    name_ = std::string("ShiftedRotated") + function_->problem_name;
+
+    TransformedProblem::setup(config, pm);
+}
+
+ShiftedRotatedFunction::Object ShiftedRotatedFunction::transformed_function(
+                                            const Object* const* shifted,
+                                            const Object* const* rotated,
+                                            Object* workspace) const
+{
+    return function_->evaluate(rotated[0], dimension_of_decision_space_);
+}
+
+}
@@ -0,0 +1,228 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <random>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include "problem/cec/TransformData.h"
+#include "util/math_tool.h"
+
+#ifdef ADEF_HAS_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace adef {
+
+namespace {
+
+/**
+@brief The random numbers which are the same on all platforms,
+unlike the distributions of the standard library.
+*/
+class PortableRandom
+{
+public:
+
+    explicit PortableRandom(unsigned int seed) : engine_(seed) {}
+
+/// Return a uniform number in [0, 1).
+    double uniform()
+    {
+        return static_cast<double>(engine_() >> 11) * (1.0 / 9007199254740992.0);
+    }
+/// Return a standard normal number by the Box-Muller transform.
+    double normal()
+    {
+        auto u1 = 1.0 - uniform();
+        auto u2 = uniform();
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * pi() * u2);
+    }
+/// Return a uniform integer in [0, bound).
+    std::size_t index(std::size_t bound)
+    {
+        // reject the values which make the remainder biased
+        std::uint64_t limit = engine_.max() - engine_.max() % bound;
+        std::uint64_t value;
+        do { value = engine_(); } while (value >= limit);
+        return static_cast<std::size_t>(value % bound);
+    }
+
+private:
+
+    std::mt19937_64 engine_;
+};
+
+/**
+@brief Return the shared data of the key, or create it.
+*/
+template<typename Create>
+std::shared_ptr<const TransformData> find_or_create(const std::string& key,
+                                                    Create&& create)
+{
+    static std::mutex mutex;
+    static std::map<std::string, std::weak_ptr<const TransformData>> shared;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto data = shared[key].lock();
+    if (!data) {
+        data = create();
+        shared[key] = data;
+    }
+    return data;
+}
+
+}
+
+TransformData::TransformData(std::size_t dimension,
+                             std::size_t number_of_components) :
+    dimension_(dimension), number_of_components_(number_of_components),
+    data_(nullptr), mapping_(nullptr), mapping_size_(0)
+{
+}
+
+TransformData::~TransformData()
+{
+#ifdef ADEF_HAS_MMAP
+    if (mapping_) { munmap(mapping_, mapping_size_); }
+#endif
+}
+
+std::shared_ptr<const TransformData> TransformData::generate(
+                                        std::size_t dimension,
+                                        std::size_t number_of_components,
+                                        unsigned int seed)
+{
+    std::stringstream key;
+    key << "seed:" << seed << ":" << dimension << ":" << number_of_components;
+    return find_or_create(key.str(), [&] {
+        auto data = std::make_shared<TransformData>(dimension,
+                                                    number_of_components);
+        data->storage_.resize(data->size());
+        data->data_ = data->storage_.data();
+
+        PortableRandom random(seed);
+        auto shifts = data->storage_.data();
+        for (std::size_t idx = 0; idx < number_of_components * dimension; ++idx) {
+            shifts[idx] = -80.0 + 160.0 * random.uniform();
+        }
+
+        for (std::size_t comp = 0; comp < number_of_components; ++comp) {
+            auto matrix = data->storage_.data() +
+                          number_of_components * dimension +
+                          comp * dimension * dimension;
+            for (std::size_t idx = 0; idx < dimension * dimension; ++idx) {
+                matrix[idx] = random.normal();
+            }
+            // the modified Gram-Schmidt process on the columns
+            for (std::size_t col = 0; col < dimension; ++col) {
+                auto column = matrix + col * dimension;
+                for (std::size_t prev = 0; prev < col; ++prev) {
+                    auto basis = matrix + prev * dimension;
+                    double dot = 0.0;
+                    for (std::size_t row = 0; row < dimension; ++row) {
+                        dot += column[row] * basis[row];
+                    }
+                    for (std::size_t row = 0; row < dimension; ++row) {
+                        column[row] -= dot * basis[row];
+                    }
+                }
+                double norm = 0.0;
+                for (std::size_t row = 0; row < dimension; ++row) {
+                    norm += column[row] * column[row];
+                }
+                norm = std::sqrt(norm);
+                for (std::size_t row = 0; row < dimension; ++row) {
+                    column[row] /= norm;
+                }
+            }
+        }
+        return std::shared_ptr<const TransformData>(std::move(data));
+    });
+}
+
+std::shared_ptr<const TransformData> TransformData::load(
+                                        const std::string& file_name,
+                                        std::size_t dimension,
+                                        std::size_t number_of_components)
+{
+    std::stringstream key;
+    key << "file:" << file_name << ":" << dimension << ":"
+        << number_of_components;
+    return find_or_create(key.str(), [&] {
+        auto data = std::make_shared<TransformData>(dimension,
+                                                    number_of_components);
+        auto bytes = data->size() * sizeof(double);
+        auto size_error = [&] {
+            std::stringstream ss;
+            ss << "The data file \"" << file_name << "\" is not " << bytes
+               << " bytes of " << number_of_components << " shifts and "
+               << "rotations of dimension " << dimension << ".";
+            return std::runtime_error(ss.str());
+        };
+
+#ifdef ADEF_HAS_MMAP
+        int fd = open(file_name.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open the data file \"" +
+                                     file_name + "\".");
+        }
+        struct stat status;
+        if (fstat(fd, &status) != 0 ||
+            static_cast<std::size_t>(status.st_size) != bytes) {
+            close(fd);
+            throw size_error();
+        }
+        auto memory = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (memory == MAP_FAILED) {
+            throw std::runtime_error("Cannot map the data file \"" +
+                                     file_name + "\".");
+        }
+        data->mapping_ = memory;
+        data->mapping_size_ = bytes;
+        data->data_ = static_cast<const double*>(memory);
+#else
+        std::ifstream ifs(file_name, std::ios::binary | std::ios::ate);
+        if (!ifs) {
+            throw std::runtime_error("Cannot open the data file \"" +
+                                     file_name + "\".");
+        }
+        if (static_cast<std::size_t>(ifs.tellg()) != bytes) {
+            throw size_error();
+        }
+        ifs.seekg(0);
+        data->storage_.resize(data->size());
+        ifs.read(reinterpret_cast<char*>(data->storage_.data()), bytes);
+        data->data_ = data->storage_.data();
+#endif
+        return std::shared_ptr<const TransformData>(std::move(data));
+    });
+}
+
+std::vector<std::size_t> TransformData::generate_permutation(
+                                                    std::size_t dimension,
+                                                    unsigned int seed)
+{
+    std::vector<std::size_t> permutation(dimension);
+    for (std::size_t idx = 0; idx < dimension; ++idx) {
+        permutation[idx] = idx;
+    }
+    // the Fisher-Yates shuffle
+    PortableRandom random(seed);
+    for (std::size_t idx = dimension; idx > 1; --idx) {
+        std::swap(permutation[idx - 1], permutation[random.index(idx)]);
+    }
+    return permutation;
+}
+
+}
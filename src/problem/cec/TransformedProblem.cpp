@@ -0,0 +1,135 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <sstream>
+#include <cstddef>
+#include "problem/cec/TransformedProblem.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+#include "Individual.h"
+#include "util/matrix_vector.h"
+
+namespace adef {
+
+TransformedProblem::TransformedProblem(const std::string& name) :
+    Problem(name), seed_(1)
+{
+}
+
+void TransformedProblem::setup(const Configuration& config,
+                               const PrototypeManager& pm)
+{
+    problem_kind_ = MIN;
+
+    auto dim_ds_config = config.get_config("dimension_of_decision_space");
+    dimension_of_decision_space_ = dim_ds_config.is_null() ?
+                                    30 : dim_ds_config.get_uint_value();
+    auto lb_ds_config = config.get_config("lower_bound_of_decision_space");
+    auto lb_ds = lb_ds_config.is_null() ?
+                        -100.0 : lb_ds_config.get_value<Object>();
+    auto ub_ds_config = config.get_config("upper_bound_of_decision_space");
+    auto ub_ds = ub_ds_config.is_null() ?
+                        100.0 : ub_ds_config.get_value<Object>();
+    boundaries_of_decision_space_.assign(dimension_of_decision_space_,
+                                         Boundary(lb_ds, ub_ds));
+
+    dimension_of_objective_space_ = 1;
+
+    auto optimal_config = config.get_config("optimal_solution");
+    optimal_solution_ = optimal_config.is_null() ?
+                            0.0 : optimal_config.get_value<Object>();
+
+    auto seed_config = config.get_config("seed");
+    seed_ = seed_config.is_null() ? 1 : seed_config.get_uint_value();
+
+    auto file_config = config.get_config("data_file");
+    data_ = file_config.is_null() ?
+                TransformData::generate(dimension_of_decision_space_,
+                                        number_of_components(), seed_) :
+                TransformData::load(file_config.get_string_value(),
+                                    dimension_of_decision_space_,
+                                    number_of_components());
+
+    // the problems of a suite have their own outputs
+    auto name_config = config.get_config("name");
+    if (!name_config.is_null()) {
+        name_ = name_config.get_string_value();
+        return;
+    }
+    if (optimal_solution_ != 0.0) {
+        std::ostringstream oss;
+        oss << "_" << optimal_solution_;
+        name_ += oss.str();
+    }
+    if (!file_config.is_null()) {
+        // the file name without the directories and the extension
+        auto file = file_config.get_string_value();
+        auto first = file.find_last_of("/\\");
+        file = file.substr(first == std::string::npos ? 0 : first + 1);
+        name_ += "_" + file.substr(0, file.find_last_of('.'));
+    }
+    else if (seed_ != 1) {
+        name_ += "_seed" + std::to_string(seed_);
+    }
+}
+
+void TransformedProblem::evaluation_function(Individual& individual) const
+{
+    evaluate_batch(std::vector<Individual*>{ &individual });
+}
+
+void TransformedProblem::evaluate_batch(
+                        const std::vector<Individual*>& individuals) const
+{
+    // the individuals are transformed by blocks, which stay in the cache
+    constexpr std::size_t block = 16;
+    auto dimension = dimension_of_decision_space_;
+    auto components = number_of_components();
+    auto size = std::min(block, individuals.size());
+
+    std::vector<Object> shifted(size * components * dimension);
+    std::vector<Object> rotated(shifted.size());
+    std::vector<Object> workspace(dimension);
+    std::vector<const Object*> inputs(size);
+    std::vector<Object*> outputs(size);
+    std::vector<const Object*> shifted_rows(components);
+    std::vector<const Object*> rotated_rows(components);
+
+    for (std::size_t first = 0; first < individuals.size(); first += block) {
+        auto count = std::min(block, individuals.size() - first);
+
+        for (std::size_t comp = 0; comp < components; ++comp) {
+            auto shift = data_->shift(comp);
+            for (std::size_t idx = 0; idx < count; ++idx) {
+                auto row = (idx * components + comp) * dimension;
+                auto variables = individuals[first + idx]->variable_data();
+                for (std::size_t dim = 0; dim < dimension; ++dim) {
+                    shifted[row + dim] = variables[dim] - shift[dim];
+                }
+                inputs[idx] = shifted.data() + row;
+                outputs[idx] = rotated.data() + row;
+            }
+            multiply_columns(data_->rotation(comp), dimension,
+                             inputs.data(), outputs.data(), count);
+        }
+
+        for (std::size_t idx = 0; idx < count; ++idx) {
+            for (std::size_t comp = 0; comp < components; ++comp) {
+                auto row = (idx * components + comp) * dimension;
+                shifted_rows[comp] = shifted.data() + row;
+                rotated_rows[comp] = rotated.data() + row;
+            }
+            auto value = transformed_function(shifted_rows.data(),
+                                              rotated_rows.data(),
+                                              workspace.data()) +
+                         optimal_solution_;
+
+            auto&& individual = *individuals[first + idx];
+            individual.objectives() = value;
+            individual.set_fitness_value(value);
+        }
+    }
+}
+
+}
@@ -0,0 +1,185 @@
+#include <string>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include "problem/cec/basic_functions.h"
+#include "util/math_tool.h"
+
+namespace adef {
+
+namespace {
+
+double sphere(const double* z, std::size_t dimension)
+{
+    double sum = 0.0;
+    for (std::size_t idx = 0; idx < dimension; ++idx) {
+        sum += z[idx] * z[idx];
+    }
+    return sum;
+}
+
+double elliptic(const double* z, std::size_t dimension)
+{
+    double sum = 0.0;
+    for (std::size_t idx = 0; idx < dimension; ++idx) {
+        auto exponent = dimension > 1 ?
+                        static_cast<double>(idx) / (dimension - 1) : 0.0;
+        sum += std::pow(1.0e6, exponent) * z[idx] * z[idx];
+    }
+    return sum;
+}
+
+double bent_cigar(const double* z, std::size_t dimension)
+{
+    double sum = 0.0;
+    for (std::size_t idx = 1; idx < dimension; ++idx) {
+        sum += z[idx] * z[idx];
+    }
+    return z[0] * z[0] + 1.0e6 * sum;
+}
+
+double discus(const double* z, std::size_t dimension)
+{
+    double sum = 0.0;
+    for (std::size_t idx = 1; idx < dimension; ++idx) {
+        sum += z[idx] * z[idx];
+    }
+    return 1.0e6 * z[0] * z[0] + sum;
+}
+
+double rosenbrock(const double* z, std::size_t dimension)
+{
+    double sum = 0.0;
+    for (std::size_t idx = 0; idx + 1 < dimension; ++idx) {
+        auto z0 = z[idx] * 2.048 / 100.0 + 1.0;
+        auto z1 = z[idx + 1] * 2.048 / 100.0 + 1.0;
+        sum += 100.0 * (z0 * z0 - z1) * (z0 * z0 - z1) + (z0 - 1.0) * (z0 - 1.0);
+    }
+    return sum;
+}
+
+double ackley(const double* z, std::size_t dimension)
+{
+    double sum_square = 0.0, sum_cos = 0.0;
+    for (std::size_t idx = 0; idx < dimension; ++idx) {
+        sum_square += z[idx] * z[idx];
+        sum_cos += std::cos(2.0 * pi() * z[idx]);
+    }
+    return -20.0 * std::exp(-0.2 * std::sqrt(sum_square / dimension)) -
+           std::exp(sum_cos / dimension) + 20.0 + std::exp(1.0);
+}
+
+double griewank(const double* z, std::size_t dimension)
+{
+    double sum = 0.0, product = 1.0;
+    for (std::size_t idx = 0; idx < dimension; ++idx) {
+        auto value = z[idx] * 600.0 / 100.0;
+        sum += value * value;
+        product *= std::cos(value / std::sqrt(idx + 1.0));
+    }
+    return 1.0 + sum / 4000.0 - product;
+}
+
+double rastrigin(const double* z, std::size_t dimension)
+{
+    double sum = 0.0;
+    for (std::size_t idx = 0; idx < dimension; ++idx) {
+        auto value = z[idx] * 5.12 / 100.0;
+        sum += value * value - 10.0 * std::cos(2.0 * pi() * value) + 10.0;
+    }
+    return sum;
+}
+
+double schwefel(const double* z, std::size_t dimension)
+{
+    double sum = 0.0;
+    for (std::size_t idx = 0; idx < dimension; ++idx) {
+        auto value = z[idx] * 1000.0 / 100.0 + 4.209687462275036e+002;
+        // the values out of [-500, 500] are folded and penalized
+        if (value > 500.0) {
+            auto folded = 500.0 - std::fmod(value, 500.0);
+            auto penalty = (value - 500.0) / 100.0;
+            sum -= folded * std::sin(std::sqrt(folded));
+            sum += penalty * penalty / dimension;
+        }
+        else if (value < -500.0) {
+            auto folded = -500.0 + std::fmod(std::abs(value), 500.0);
+            auto penalty = (value + 500.0) / 100.0;
+            sum -= folded * std::sin(std::sqrt(500.0 - std::fmod(std::abs(value), 500.0)));
+            sum += penalty * penalty / dimension;
+        }
+        else {
+            sum -= value * std::sin(std::sqrt(std::abs(value)));
+        }
+    }
+    return sum + 4.189828872724338e+002 * dimension;
+}
+
+double katsuura(const double* z, std::size_t dimension)
+{
+    auto exponent = 10.0 / std::pow(static_cast<double>(dimension), 1.2);
+    double product = 1.0;
+    for (std::size_t idx = 0; idx < dimension; ++idx) {
+        auto value = z[idx] * 5.0 / 100.0;
+        double inner = 0.0;
+        for (unsigned int j = 1; j <= 32; ++j) {
+            auto two_j = std::pow(2.0, static_cast<double>(j));
+            auto two_j_value = two_j * value;
+            inner += std::abs(two_j_value - std::floor(two_j_value + 0.5)) / two_j;
+        }
+        product *= std::pow(1.0 + (idx + 1.0) * inner, exponent);
+    }
+    auto scale = 10.0 / dimension / dimension;
+    return scale * product - scale;
+}
+
+double happycat(const double* z, std::size_t dimension)
+{
+    double sum = 0.0, sum_square = 0.0;
+    for (std::size_t idx = 0; idx < dimension; ++idx) {
+        auto value = z[idx] * 5.0 / 100.0 - 1.0;
+        sum += value;
+        sum_square += value * value;
+    }
+    return std::pow(std::abs(sum_square - dimension), 0.25) +
+           (0.5 * sum_square + sum) / dimension + 0.5;
+}
+
+double hgbat(const double* z, std::size_t dimension)
+{
+    double sum = 0.0, sum_square = 0.0;
+    for (std::size_t idx = 0; idx < dimension; ++idx) {
+        auto value = z[idx] * 5.0 / 100.0 - 1.0;
+        sum += value;
+        sum_square += value * value;
+    }
+    return std::sqrt(std::abs(sum_square * sum_square - sum * sum)) +
+           (0.5 * sum_square + sum) / dimension + 0.5;
+}
+
+const BasicFunction basic_functions[] = {
+    { "sphere", "Sphere", sphere },
+    { "elliptic", "Elliptic", elliptic },
+    { "bent_cigar", "BentCigar", bent_cigar },
+    { "discus", "Discus", discus },
+    { "rosenbrock", "Rosenbrock", rosenbrock },
+    { "ackley", "Ackley", ackley },
+    { "griewank", "Griewank", griewank },
+    { "rastrigin", "Rastrigin", rastrigin },
+    { "schwefel", "Schwefel", schwefel },
+    { "katsuura", "Katsuura", katsuura },
+    { "happycat", "HappyCat", happycat },
+    { "hgbat", "HGBat", hgbat }
+};
+
+}
+
+const BasicFunction& find_basic_function(const std::string& name)
+{
+    for (auto&& function : basic_functions) {
+        if (name == function.name) { return function; }
+    }
+    throw std::domain_error("The basic function \"" + name + "\" is unknown.");
+}
+
+}
@@ -0,0 +1,116 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include "problem/plugin/PluginProblem.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+#include "Individual.h"
+
+namespace adef {
+
+PluginProblem::PluginProblem(const adef_plugin_problem* descriptor) :
+    Problem(descriptor->name ? descriptor->name : descriptor->classname),
+    descriptor_(descriptor)
+{
+}
+
+void PluginProblem::setup(const Configuration& config, const PrototypeManager& pm)
+{
+    Problem::setup(config, pm);
+
+    // the configuration overrides the defaults of the plugin
+    if (config.get_config("kind").is_null()) {
+        problem_kind_ = (descriptor_->kind == ADEF_PLUGIN_MAX) ? MAX : MIN;
+    }
+
+    if (config.get_config("dimension_of_decision_space").is_null()) {
+        dimension_of_decision_space_ = descriptor_->dimension_of_decision_space;
+    }
+    auto lb_ds_config = config.get_config("lower_bound_of_decision_space");
+    auto lb_ds = lb_ds_config.is_null() ?
+                    descriptor_->lower_bound_of_decision_space :
+                    lb_ds_config.get_value<Object>();
+    auto ub_ds_config = config.get_config("upper_bound_of_decision_space");
+    auto ub_ds = ub_ds_config.is_null() ?
+                    descriptor_->upper_bound_of_decision_space :
+                    ub_ds_config.get_value<Object>();
+    boundaries_of_decision_space_.assign(dimension_of_decision_space_,
+                                         Boundary(lb_ds, ub_ds));
+
+    if (config.get_config("dimension_of_objective_space").is_null()) {
+        dimension_of_objective_space_ = descriptor_->dimension_of_objective_space;
+    }
+    if (dimension_of_objective_space_ == 0) {
+        dimension_of_objective_space_ = 1;
+    }
+    boundaries_of_objective_space_.resize(dimension_of_objective_space_);
+
+    if (config.get_config("optimal_solution").is_null()) {
+        optimal_solution_ = descriptor_->optimal_solution;
+    }
+}
+
+void PluginProblem::evaluation_function(Individual& individual) const
+{
+    if (individual.dimension_of_objective() != dimension_of_objective_space_) {
+        throw std::logic_error("The Individual does not fit the Problem \"" +
+                               name() + "\".");
+    }
+    auto error = descriptor_->evaluate(descriptor_->context,
+                                       individual.variable_data(),
+                                       individual.dimension_of_variable(),
+                                       individual.objective_data(),
+                                       dimension_of_objective_space_);
+    if (error != 0) {
+        throw std::runtime_error("The Problem \"" + name() +
+                                 "\" fails to evaluate.");
+    }
+    individual.set_fitness_value(individual.objectives(0));
+}
+
+void PluginProblem::evaluate_batch(const std::vector<Individual*>& individuals) const
+{
+    if (!descriptor_->evaluate_batch || individuals.empty()) {
+        Problem::evaluate_batch(individuals);
+        return;
+    }
+
+    std::size_t dimension = dimension_of_decision_space_;
+    std::size_t objectives = dimension_of_objective_space_;
+    for (auto individual : individuals) {
+        if (individual->dimension_of_variable() != dimension ||
+            individual->dimension_of_objective() != objectives) {
+            throw std::logic_error("The Individual does not fit "
+                                   "the Problem \"" + name() + "\".");
+        }
+    }
+
+    // the Problem may be shared by islands, so the matrices are local
+    std::vector<double> variables(individuals.size() * dimension);
+    std::vector<double> values(individuals.size() * objectives);
+    for (std::size_t idx = 0; idx < individuals.size(); ++idx) {
+        std::memcpy(variables.data() + idx * dimension,
+                    individuals[idx]->variable_data(),
+                    dimension * sizeof(double));
+    }
+    auto error = descriptor_->evaluate_batch(descriptor_->context,
+                                             variables.data(),
+                                             individuals.size(), dimension,
+                                             values.data(), objectives);
+    if (error != 0) {
+        throw std::runtime_error("The Problem \"" + name() +
+                                 "\" fails to evaluate.");
+    }
+    for (std::size_t idx = 0; idx < individuals.size(); ++idx) {
+        auto& individual = *individuals[idx];
+        std::memcpy(individual.objective_data(),
+                    values.data() + idx * objectives,
+                    objectives * sizeof(double));
+        individual.set_fitness_value(individual.objectives(0));
+    }
+}
+
+}
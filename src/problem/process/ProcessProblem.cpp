@@ -0,0 +1,374 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include "problem/process/ProcessProblem.h"
+#include "problem/process/process_protocol.h"
+#include "Configuration.h"
+#include "PrototypeManager.h"
+#include "Individual.h"
+
+extern char** environ;
+
+namespace adef {
+
+struct ProcessProblem::Worker {
+
+    using Clock = std::chrono::steady_clock;
+
+    ~Worker()
+    {
+        stop(true);
+        if (header) { munmap(header, size); }
+        if (!shm_name.empty()) { shm_unlink(shm_name.c_str()); }
+    }
+
+/**
+@brief Create the shared memory.
+*/
+    void map(std::uint32_t dimension, std::uint32_t objectives,
+             std::uint32_t max_batch)
+    {
+        static std::atomic<unsigned int> counter(0);
+        shm_name = "/adef-" + std::to_string(getpid()) + "-" +
+                   std::to_string(counter++);
+        size = adef_process_size(dimension, objectives, max_batch);
+
+        int fd = shm_open(shm_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0) {
+            shm_name.clear();
+            throw std::runtime_error("ProcessProblem can not create "
+                                     "the shared memory.");
+        }
+        void* memory = MAP_FAILED;
+        if (ftruncate(fd, size) == 0) {
+            memory = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        if (memory == MAP_FAILED) {
+            throw std::runtime_error("ProcessProblem can not map "
+                                     "the shared memory.");
+        }
+        header = static_cast<adef_process_header*>(memory);
+        header->magic = ADEF_PROCESS_MAGIC;
+        header->version = ADEF_PROCESS_VERSION;
+        header->size = size;
+        header->dimension = dimension;
+        header->objectives = objectives;
+        header->max_batch = max_batch;
+        header->reserved = 0;
+    }
+/**
+@brief Spawn the process whose standard input and output are the socket.
+*/
+    void spawn(const std::string& command)
+    {
+        int sockets[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) != 0) {
+            throw std::runtime_error("ProcessProblem can not create "
+                                     "the socket.");
+        }
+
+        std::string shm_env = std::string(ADEF_PROCESS_SHM_ENV) + "=" +
+                              shm_name;
+        std::string prefix = std::string(ADEF_PROCESS_SHM_ENV) + "=";
+        std::vector<char*> envp;
+        for (auto env = environ; *env; ++env) {
+            if (std::strncmp(*env, prefix.c_str(), prefix.size()) != 0) {
+                envp.push_back(*env);
+            }
+        }
+        envp.push_back(&shm_env[0]);
+        envp.push_back(nullptr);
+
+        std::string shell = "sh", option = "-c", line = command;
+        char* argv[] = { &shell[0], &option[0], &line[0], nullptr };
+
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, sockets[1], STDIN_FILENO);
+        posix_spawn_file_actions_adddup2(&actions, sockets[1], STDOUT_FILENO);
+        // the process group is killed together with the children of the shell
+        posix_spawnattr_t attributes;
+        posix_spawnattr_init(&attributes);
+        posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+        posix_spawnattr_setpgroup(&attributes, 0);
+        auto error = posix_spawn(&pid, "/bin/sh", &actions, &attributes,
+                                 argv, envp.data());
+        posix_spawnattr_destroy(&attributes);
+        posix_spawn_file_actions_destroy(&actions);
+        close(sockets[1]);
+        if (error != 0) {
+            close(sockets[0]);
+            pid = -1;
+            throw std::runtime_error("ProcessProblem can not spawn \"" +
+                                     command + "\".");
+        }
+        socket = sockets[0];
+    }
+/**
+@brief Stop the process.
+@param graceful Close the standard input and wait a moment before
+killing the process.
+*/
+    void stop(bool graceful)
+    {
+        if (socket >= 0) {
+            close(socket);
+            socket = -1;
+        }
+        if (pid < 0) { return; }
+        if (graceful) {
+            for (int count = 0; count < 100; ++count) {
+                if (waitpid(pid, nullptr, WNOHANG) == pid) {
+                    pid = -1;
+                    return;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+        kill(-pid, SIGKILL);
+        while (waitpid(pid, nullptr, 0) < 0 && errno == EINTR) {}
+        pid = -1;
+    }
+
+/// The name of the shared memory.
+    std::string shm_name;
+/// The shared memory.
+    adef_process_header* header = nullptr;
+/// The size of the shared memory.
+    std::size_t size = 0;
+/// The process, or -1 if it is not running.
+    pid_t pid = -1;
+/// The socket connected to the standard input and output of the process.
+    int socket = -1;
+/// The sequence number of the last frame.
+    std::uint32_t sequence = 0;
+/// Whether the process is evaluating the chunk.
+    bool busy = false;
+/// The index of the first individual of the chunk.
+    std::size_t first = 0;
+/// The number of individuals of the chunk.
+    std::size_t count = 0;
+/// The time when the chunk fails.
+    Clock::time_point deadline;
+};
+
+ProcessProblem::ProcessProblem() :
+    Problem("Process Problem"), command_(), number_of_workers_(1),
+    batch_size_(16), timeout_(0),
+    penalty_(std::numeric_limits<Object>::max()), workers_()
+{
+}
+
+ProcessProblem::ProcessProblem(const ProcessProblem& rhs) :
+    Problem(rhs), command_(rhs.command_),
+    number_of_workers_(rhs.number_of_workers_),
+    batch_size_(rhs.batch_size_), timeout_(rhs.timeout_),
+    penalty_(rhs.penalty_), workers_()
+{
+}
+
+ProcessProblem::~ProcessProblem()
+{
+}
+
+void ProcessProblem::setup(const Configuration& config, const PrototypeManager& pm)
+{
+    Problem::setup(config, pm);
+    if (dimension_of_objective_space_ == 0) {
+        dimension_of_objective_space_ = 1;
+        boundaries_of_objective_space_.resize(dimension_of_objective_space_);
+    }
+
+    auto command_config = config.get_config("command");
+    if (command_config.is_null()) {
+        throw std::logic_error("ProcessProblem requires the command.");
+    }
+    command_ = command_config.get_string_value();
+
+    auto workers_config = config.get_config("number_of_workers");
+    number_of_workers_ = workers_config.is_null() ?
+                            1 : workers_config.get_uint_value();
+
+    auto batch_size_config = config.get_config("batch_size");
+    batch_size_ = batch_size_config.is_null() ?
+                    16 : batch_size_config.get_uint_value();
+
+    if (number_of_workers_ == 0 || batch_size_ == 0) {
+        throw std::logic_error("ProcessProblem requires at least one worker "
+                               "and one individual per batch.");
+    }
+
+    auto timeout_config = config.get_config("timeout");
+    timeout_ = timeout_config.is_null() ?
+                    0 : timeout_config.get_double_value();
+
+    auto penalty_config = config.get_config("penalty");
+    penalty_ = penalty_config.is_null() ?
+                    std::numeric_limits<Object>::max() :
+                    penalty_config.get_value<Object>();
+}
+
+void ProcessProblem::evaluation_function(Individual& individual) const
+{
+    evaluate_batch({ &individual });
+}
+
+void ProcessProblem::evaluate_batch(const std::vector<Individual*>& individuals) const
+{
+    for (auto individual : individuals) {
+        if (individual->dimension_of_variable() != dimension_of_decision_space_ ||
+            individual->dimension_of_objective() != dimension_of_objective_space_) {
+            throw std::logic_error("The Individual does not fit "
+                                   "the ProcessProblem.");
+        }
+    }
+    if (workers_.empty()) {
+        for (unsigned int idx = 0; idx < number_of_workers_; ++idx) {
+            workers_.push_back(std::make_unique<Worker>());
+            workers_.back()->map(dimension_of_decision_space_,
+                                 dimension_of_objective_space_, batch_size_);
+        }
+    }
+
+    auto total = individuals.size();
+    std::size_t next = 0;
+    std::size_t running = 0;
+    std::vector<pollfd> fds;
+    std::vector<Worker*> polled;
+    while (true) {
+        for (auto&& worker : workers_) {
+            if (next >= total) { break; }
+            if (worker->busy) { continue; }
+            auto count = std::min(batch_size_, total - next);
+            if (dispatch(*worker, individuals, next, count)) { ++running; }
+            next += count;
+        }
+        if (running == 0) { break; }
+
+        fds.clear();
+        polled.clear();
+        int wait = -1;
+        auto now = Worker::Clock::now();
+        for (auto&& worker : workers_) {
+            if (!worker->busy) { continue; }
+            fds.push_back(pollfd{ worker->socket, POLLIN, 0 });
+            polled.push_back(worker.get());
+            if (timeout_ > 0) {
+                auto left = std::chrono::ceil<std::chrono::milliseconds>(
+                                worker->deadline - now).count();
+                left = std::max<decltype(left)>(left, 0);
+                if (wait < 0 || left < wait) { wait = static_cast<int>(left); }
+            }
+        }
+        if (poll(fds.data(), fds.size(), wait) < 0) {
+            if (errno == EINTR) { continue; }
+            throw std::runtime_error("ProcessProblem fails to wait "
+                                     "for the workers.");
+        }
+
+        now = Worker::Clock::now();
+        for (std::size_t idx = 0; idx < fds.size(); ++idx) {
+            auto& worker = *polled[idx];
+            if (fds[idx].revents != 0) {
+                if (!receive(worker, individuals)) { fail(worker, individuals); }
+                --running;
+            }
+            else if (timeout_ > 0 && now >= worker.deadline) {
+                fail(worker, individuals);
+                --running;
+            }
+        }
+    }
+}
+
+bool ProcessProblem::dispatch(Worker& worker,
+                              const std::vector<Individual*>& individuals,
+                              std::size_t first, std::size_t count) const
+{
+    auto variables = adef_process_variables(worker.header);
+    for (std::size_t idx = 0; idx < count; ++idx) {
+        std::memcpy(variables + idx * dimension_of_decision_space_,
+                    individuals[first + idx]->variable_data(),
+                    dimension_of_decision_space_ * sizeof(double));
+    }
+    worker.busy = true;
+    worker.first = first;
+    worker.count = count;
+
+    // the worker may have exited since the last batch, so try a new one
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        if (worker.pid < 0) { worker.spawn(command_); }
+
+        adef_process_frame frame{ ++worker.sequence,
+                                  static_cast<std::uint32_t>(count) };
+        if (send(worker.socket, &frame, sizeof(frame), MSG_NOSIGNAL) ==
+                static_cast<ssize_t>(sizeof(frame))) {
+            worker.deadline = Worker::Clock::now() +
+                std::chrono::duration_cast<Worker::Clock::duration>(
+                    std::chrono::duration<double>(timeout_ * count));
+            return true;
+        }
+        worker.stop(false);
+    }
+    fail(worker, individuals);
+    return false;
+}
+
+bool ProcessProblem::receive(Worker& worker,
+                             const std::vector<Individual*>& individuals) const
+{
+    adef_process_frame frame;
+    auto size = recv(worker.socket, &frame, sizeof(frame), MSG_WAITALL);
+    if (size != static_cast<ssize_t>(sizeof(frame)) ||
+        frame.sequence != worker.sequence || frame.count != worker.count) {
+        return false;
+    }
+
+    auto objectives = adef_process_objectives(worker.header);
+    for (std::size_t idx = 0; idx < worker.count; ++idx) {
+        auto& individual = *individuals[worker.first + idx];
+        auto values = objectives + idx * dimension_of_objective_space_;
+        for (std::size_t obj = 0; obj < dimension_of_objective_space_; ++obj) {
+            individual.objectives(obj) = values[obj];
+        }
+        individual.set_fitness_value(values[0]);
+    }
+    worker.busy = false;
+    return true;
+}
+
+void ProcessProblem::fail(Worker& worker,
+                          const std::vector<Individual*>& individuals) const
+{
+    worker.stop(false);
+    for (std::size_t idx = 0; idx < worker.count; ++idx) {
+        auto& individual = *individuals[worker.first + idx];
+        for (std::size_t obj = 0; obj < dimension_of_objective_space_; ++obj) {
+            individual.objectives(obj) = penalty_;
+        }
+        individual.set_fitness_value(penalty_);
+    }
+    worker.busy = false;
+}
+
+}